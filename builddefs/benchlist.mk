@@ -0,0 +1,14 @@
+BENCH_LIST = $(sort $(patsubst %/bench.mk,%, $(shell find $(ROOT_DIR)tests/benchmarks -type f -name bench.mk)))
+FULL_TESTS := $(notdir $(BENCH_LIST))
+
+define VALIDATE_BENCH_LIST
+    ifneq ($1,)
+        ifeq ($$(findstring -,$1),-)
+            $$(call CATASTROPHIC_ERROR,Invalid benchmark name,Benchmark names can't contain '-', but '$1' does.)
+        else
+            $$(eval $$(call VALIDATE_BENCH_LIST,$$(firstword $2),$$(wordlist 2,9999,$2)))
+        endif
+    endif
+endef
+
+$(eval $(call VALIDATE_BENCH_LIST,$(firstword $(BENCH_LIST)),$(wordlist 2,9999,$(BENCH_LIST))))
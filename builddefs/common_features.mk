@@ -263,7 +263,7 @@ ifneq ($(strip $(WEAR_LEVELING_DRIVER)),none)
     COMMON_VPATH += $(PLATFORM_PATH)/$(PLATFORM_KEY)/$(DRIVER_DIR)/wear_leveling
     COMMON_VPATH += $(DRIVER_PATH)/wear_leveling
     COMMON_VPATH += $(QUANTUM_DIR)/wear_leveling
-    SRC += wear_leveling.c
+    SRC += wear_leveling.c wear_leveling_stats.c
     ifeq ($(strip $(WEAR_LEVELING_DRIVER)), embedded_flash)
       OPT_DEFS += -DHAL_USE_EFL
       SRC += wear_leveling_efl.c
@@ -22,3 +22,8 @@
 void eeprom_driver_init(void);
 void eeprom_driver_format(bool erase);
 void eeprom_driver_erase(void);
+
+// Drivers that defer writes push them out from here, called every keyboard task
+void eeprom_driver_task(void);
+// Blocks until every deferred write has reached the device
+void eeprom_driver_flush(void);
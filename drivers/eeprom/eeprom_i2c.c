@@ -46,6 +46,25 @@
 #    include "debug.h"
 #endif // DEBUG_EEPROM_OUTPUT
 
+#if defined(EXTERNAL_EEPROM_WRITE_BEHIND)
+#    include "util.h"
+
+typedef struct {
+    uintptr_t page;
+    uint8_t   data[EXTERNAL_EEPROM_PAGE_SIZE];
+    uint8_t   dirty[(EXTERNAL_EEPROM_PAGE_SIZE + 7) / 8];
+} eeprom_pending_page_t;
+
+// Queued page writes, oldest first
+static eeprom_pending_page_t pending_pages[EXTERNAL_EEPROM_WRITE_BEHIND_PAGES];
+static uint8_t               pending_head  = 0;
+static uint8_t               pending_count = 0;
+
+// Set while the device is busy with its internal write cycle
+static bool      write_in_progress      = false;
+static uintptr_t write_in_progress_addr = 0;
+#endif // EXTERNAL_EEPROM_WRITE_BEHIND
+
 static inline void fill_target_address(uint8_t *buffer, const void *addr) {
     uintptr_t p = (uintptr_t)addr;
     for (int i = 0; i < EXTERNAL_EEPROM_ADDRESS_SIZE; ++i) {
@@ -54,15 +73,57 @@ static inline void fill_target_address(uint8_t *buffer, const void *addr) {
     }
 }
 
-void eeprom_driver_init(void) {
-    i2c_init();
+static inline void write_protect(bool protect) {
 #if defined(EXTERNAL_EEPROM_WP_PIN)
-    /* We are setting the WP pin to high in a way that requires at least two bit-flips to change back to 0 */
-    gpio_write_pin(EXTERNAL_EEPROM_WP_PIN, 1);
-    gpio_set_pin_input_high(EXTERNAL_EEPROM_WP_PIN);
+    if (protect) {
+        /* We are setting the WP pin to high in a way that requires at least two bit-flips to change back to 0 */
+        gpio_write_pin(EXTERNAL_EEPROM_WP_PIN, 1);
+        gpio_set_pin_input_high(EXTERNAL_EEPROM_WP_PIN);
+    } else {
+        gpio_set_pin_output(EXTERNAL_EEPROM_WP_PIN);
+        gpio_write_pin(EXTERNAL_EEPROM_WP_PIN, 0);
+    }
 #endif
 }
 
+static void device_read(void *buf, uintptr_t addr, size_t len) {
+    uint8_t complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE];
+    fill_target_address(complete_packet, (const void *)addr);
+
+    i2c_transmit(EXTERNAL_EEPROM_I2C_ADDRESS(addr), complete_packet, EXTERNAL_EEPROM_ADDRESS_SIZE, 100);
+    i2c_receive(EXTERNAL_EEPROM_I2C_ADDRESS(addr), buf, len, 100);
+
+#if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
+    dprintf("[EEPROM R] 0x%04X: ", ((int)addr));
+    for (size_t i = 0; i < len; ++i) {
+        dprintf(" %02X", (int)(((uint8_t *)buf)[i]));
+    }
+    dprintf("\n");
+#endif // DEBUG_EEPROM_OUTPUT
+}
+
+// Writes at most up to the end of the page containing `addr`
+static void device_write(const uint8_t *buf, uintptr_t addr, uint16_t len) {
+    uint8_t complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE + EXTERNAL_EEPROM_PAGE_SIZE];
+    fill_target_address(complete_packet, (const void *)addr);
+    memcpy(&complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE], buf, len);
+
+#if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
+    dprintf("[EEPROM W] 0x%04X: ", ((int)addr));
+    for (uint16_t i = 0; i < len; i++) {
+        dprintf(" %02X", (int)(buf[i]));
+    }
+    dprintf("\n");
+#endif // DEBUG_EEPROM_OUTPUT
+
+    i2c_transmit(EXTERNAL_EEPROM_I2C_ADDRESS(addr), complete_packet, EXTERNAL_EEPROM_ADDRESS_SIZE + len, 100);
+}
+
+void eeprom_driver_init(void) {
+    i2c_init();
+    write_protect(true);
+}
+
 void eeprom_driver_format(bool erase) {
     /* i2c eeproms do not need to be formatted before use */
     if (erase) {
@@ -80,37 +141,170 @@ void eeprom_driver_erase(void) {
     for (uint32_t addr = 0; addr < EXTERNAL_EEPROM_BYTE_COUNT; addr += EXTERNAL_EEPROM_PAGE_SIZE) {
         eeprom_write_block(buf, (void *)(uintptr_t)addr, EXTERNAL_EEPROM_PAGE_SIZE);
     }
+    eeprom_driver_flush();
 
 #if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
     dprintf("EEPROM erase took %ldms to complete\n", ((long)(timer_read32() - start)));
 #endif
 }
 
+#if defined(EXTERNAL_EEPROM_WRITE_BEHIND)
+
+/*
+    Writes are queued per page and merged with any queued write to the same
+    page, then written out by eeprom_driver_task() one transaction at a time.
+    Instead of sleeping for EXTERNAL_EEPROM_WRITE_TIME the device is polled,
+    as it will not acknowledge its address until the write cycle is done.
+*/
+
+static inline bool page_byte_dirty(const eeprom_pending_page_t *pending, uint16_t offset) {
+    return pending->dirty[offset / 8] & (1 << (offset % 8));
+}
+
+static eeprom_pending_page_t *find_pending_page(uintptr_t page) {
+    for (uint8_t i = 0; i < pending_count; i++) {
+        eeprom_pending_page_t *pending = &pending_pages[(pending_head + i) % EXTERNAL_EEPROM_WRITE_BEHIND_PAGES];
+        if (pending->page == page) {
+            return pending;
+        }
+    }
+    return NULL;
+}
+
+static void finish_write(void) {
+    write_in_progress = false;
+    write_protect(true);
+}
+
+static bool device_ready(void) {
+    if (write_in_progress && i2c_ping_address(EXTERNAL_EEPROM_I2C_ADDRESS(write_in_progress_addr), 100) == I2C_STATUS_SUCCESS) {
+        finish_write();
+    }
+    return !write_in_progress;
+}
+
+static void wait_until_ready(void) {
+    for (uint16_t elapsed = 0; elapsed < EXTERNAL_EEPROM_WRITE_TIME && !device_ready(); elapsed++) {
+        wait_ms(1);
+    }
+    // Past the datasheet write time the cycle is done, whether or not the device answered
+    finish_write();
+}
+
+// Writes the first run of dirty bytes of the oldest queued page
+static void write_next_run(void) {
+    eeprom_pending_page_t *pending = &pending_pages[pending_head];
+    uint16_t               start   = 0;
+    while (!page_byte_dirty(pending, start)) {
+        start++;
+    }
+    uint16_t end = start;
+    while (end < EXTERNAL_EEPROM_PAGE_SIZE && page_byte_dirty(pending, end)) {
+        pending->dirty[end / 8] &= ~(1 << (end % 8));
+        end++;
+    }
+
+    write_protect(false);
+    device_write(&pending->data[start], pending->page + start, end - start);
+    write_in_progress      = EXTERNAL_EEPROM_WRITE_TIME > 0;
+    write_in_progress_addr = pending->page;
+    if (!write_in_progress) {
+        write_protect(true);
+    }
+
+    for (uint16_t i = 0; i < sizeof(pending->dirty); i++) {
+        if (pending->dirty[i]) {
+            return;
+        }
+    }
+    pending_head = (pending_head + 1) % EXTERNAL_EEPROM_WRITE_BEHIND_PAGES;
+    pending_count--;
+}
+
+// Copies queued bytes over `buf`, returns true if every byte was queued
+static bool read_pending(uint8_t *buf, uintptr_t addr, size_t len) {
+    bool covered = true;
+    for (size_t i = 0; i < len; i++) {
+        uintptr_t              target  = addr + i;
+        eeprom_pending_page_t *pending = find_pending_page(target - target % EXTERNAL_EEPROM_PAGE_SIZE);
+        if (pending && page_byte_dirty(pending, target % EXTERNAL_EEPROM_PAGE_SIZE)) {
+            buf[i] = pending->data[target % EXTERNAL_EEPROM_PAGE_SIZE];
+        } else {
+            covered = false;
+        }
+    }
+    return covered;
+}
+
 void eeprom_read_block(void *buf, const void *addr, size_t len) {
-    uint8_t complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE];
-    fill_target_address(complete_packet, addr);
+    if (read_pending(buf, (uintptr_t)addr, len)) {
+        return;
+    }
+    wait_until_ready();
+    device_read(buf, (uintptr_t)addr, len);
+    read_pending(buf, (uintptr_t)addr, len);
+}
 
-    i2c_transmit(EXTERNAL_EEPROM_I2C_ADDRESS((uintptr_t)addr), complete_packet, EXTERNAL_EEPROM_ADDRESS_SIZE, 100);
-    i2c_receive(EXTERNAL_EEPROM_I2C_ADDRESS((uintptr_t)addr), buf, len, 100);
+void eeprom_write_block(const void *buf, void *addr, size_t len) {
+    const uint8_t *read_buf    = (const uint8_t *)buf;
+    uintptr_t      target_addr = (uintptr_t)addr;
 
-#if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
-    dprintf("[EEPROM R] 0x%04X: ", ((int)addr));
-    for (size_t i = 0; i < len; ++i) {
-        dprintf(" %02X", (int)(((uint8_t *)buf)[i]));
+    while (len > 0) {
+        uintptr_t page         = target_addr - target_addr % EXTERNAL_EEPROM_PAGE_SIZE;
+        uint16_t  page_offset  = target_addr - page;
+        uint16_t  write_length = MIN(len, EXTERNAL_EEPROM_PAGE_SIZE - page_offset);
+
+        eeprom_pending_page_t *pending = find_pending_page(page);
+        if (!pending) {
+            if (pending_count == EXTERNAL_EEPROM_WRITE_BEHIND_PAGES) {
+                // Queue full, make room by writing out the oldest page now
+                for (uint8_t count = pending_count; pending_count == count;) {
+                    wait_until_ready();
+                    write_next_run();
+                }
+            }
+            pending       = &pending_pages[(pending_head + pending_count) % EXTERNAL_EEPROM_WRITE_BEHIND_PAGES];
+            pending->page = page;
+            memset(pending->dirty, 0, sizeof(pending->dirty));
+            pending_count++;
+        }
+
+        memcpy(&pending->data[page_offset], read_buf, write_length);
+        for (uint16_t i = page_offset; i < page_offset + write_length; i++) {
+            pending->dirty[i / 8] |= 1 << (i % 8);
+        }
+
+        read_buf += write_length;
+        target_addr += write_length;
+        len -= write_length;
+    }
+}
+
+void eeprom_driver_task(void) {
+    if (device_ready() && pending_count > 0) {
+        write_next_run();
     }
-    dprintf("\n");
-#endif // DEBUG_EEPROM_OUTPUT
+}
+
+void eeprom_driver_flush(void) {
+    while (pending_count > 0) {
+        wait_until_ready();
+        write_next_run();
+    }
+    wait_until_ready();
+}
+
+#else // EXTERNAL_EEPROM_WRITE_BEHIND
+
+void eeprom_read_block(void *buf, const void *addr, size_t len) {
+    device_read(buf, (uintptr_t)addr, len);
 }
 
 void eeprom_write_block(const void *buf, void *addr, size_t len) {
-    uint8_t   complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE + EXTERNAL_EEPROM_PAGE_SIZE];
-    uint8_t * read_buf    = (uint8_t *)buf;
-    uintptr_t target_addr = (uintptr_t)addr;
+    const uint8_t *read_buf    = (const uint8_t *)buf;
+    uintptr_t      target_addr = (uintptr_t)addr;
 
-#if defined(EXTERNAL_EEPROM_WP_PIN)
-    gpio_set_pin_output(EXTERNAL_EEPROM_WP_PIN);
-    gpio_write_pin(EXTERNAL_EEPROM_WP_PIN, 0);
-#endif
+    write_protect(false);
 
     while (len > 0) {
         uintptr_t page_offset  = target_addr % EXTERNAL_EEPROM_PAGE_SIZE;
@@ -119,20 +313,7 @@ void eeprom_write_block(const void *buf, void *addr, size_t len) {
             write_length = len;
         }
 
-        fill_target_address(complete_packet, (const void *)target_addr);
-        for (uint8_t i = 0; i < write_length; i++) {
-            complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE + i] = read_buf[i];
-        }
-
-#if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
-        dprintf("[EEPROM W] 0x%04X: ", ((int)target_addr));
-        for (uint8_t i = 0; i < write_length; i++) {
-            dprintf(" %02X", (int)(read_buf[i]));
-        }
-        dprintf("\n");
-#endif // DEBUG_EEPROM_OUTPUT
-
-        i2c_transmit(EXTERNAL_EEPROM_I2C_ADDRESS((uintptr_t)addr), complete_packet, EXTERNAL_EEPROM_ADDRESS_SIZE + write_length, 100);
+        device_write(read_buf, target_addr, write_length);
         wait_ms(EXTERNAL_EEPROM_WRITE_TIME);
 
         read_buf += write_length;
@@ -140,9 +321,7 @@ void eeprom_write_block(const void *buf, void *addr, size_t len) {
         len -= write_length;
     }
 
-#if defined(EXTERNAL_EEPROM_WP_PIN)
-    /* We are setting the WP pin to high in a way that requires at least two bit-flips to change back to 0 */
-    gpio_write_pin(EXTERNAL_EEPROM_WP_PIN, 1);
-    gpio_set_pin_input_high(EXTERNAL_EEPROM_WP_PIN);
-#endif
+    write_protect(true);
 }
+
+#endif // EXTERNAL_EEPROM_WRITE_BEHIND
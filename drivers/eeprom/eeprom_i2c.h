@@ -123,3 +123,12 @@
 #ifndef EXTERNAL_EEPROM_WRITE_TIME
 #    define EXTERNAL_EEPROM_WRITE_TIME 5
 #endif
+
+/*
+    The number of pages queued when EXTERNAL_EEPROM_WRITE_BEHIND is defined.
+    Writes only wait for the EEPROM once this many distinct pages are pending,
+    each costs a little over EXTERNAL_EEPROM_PAGE_SIZE bytes of RAM.
+*/
+#ifndef EXTERNAL_EEPROM_WRITE_BEHIND_PAGES
+#    define EXTERNAL_EEPROM_WRITE_BEHIND_PAGES 4
+#endif
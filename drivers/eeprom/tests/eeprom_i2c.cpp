@@ -0,0 +1,41 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "i2c_eeprom_mock.hpp"
+
+extern "C" {
+#include "eeprom.h"
+#include "eeprom_driver.h"
+};
+
+class EepromI2C : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockI2CEeprom::Instance().reset_instance();
+    }
+};
+
+TEST_F(EepromI2C, WritesAreSplitAtPageBoundaries) {
+    auto&   inst = MockI2CEeprom::Instance();
+    uint8_t data[EXTERNAL_EEPROM_PAGE_SIZE + 4];
+    for (size_t i = 0; i < sizeof(data); ++i) {
+        data[i] = i;
+    }
+
+    eeprom_write_block(data, (void*)(EXTERNAL_EEPROM_PAGE_SIZE - 2), sizeof(data));
+    EXPECT_EQ(inst.page_writes(), 3);
+    EXPECT_EQ(inst.time_waited(), 3 * EXTERNAL_EEPROM_WRITE_TIME);
+
+    uint8_t read[sizeof(data)];
+    eeprom_read_block(read, (void*)(EXTERNAL_EEPROM_PAGE_SIZE - 2), sizeof(read));
+    EXPECT_EQ(memcmp(data, read, sizeof(data)), 0);
+}
+
+TEST_F(EepromI2C, UpdateSkipsUnchangedData) {
+    auto& inst = MockI2CEeprom::Instance();
+    eeprom_update_byte((uint8_t*)3, 0x42);
+    eeprom_update_byte((uint8_t*)3, 0x42);
+    EXPECT_EQ(inst.page_writes(), 1);
+    EXPECT_EQ(eeprom_read_byte((const uint8_t*)3), 0x42);
+}
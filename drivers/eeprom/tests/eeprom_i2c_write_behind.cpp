@@ -0,0 +1,143 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "i2c_eeprom_mock.hpp"
+
+extern "C" {
+#include "eeprom.h"
+#include "eeprom_driver.h"
+};
+
+#define PAGE(n) ((void*)((n) * EXTERNAL_EEPROM_PAGE_SIZE))
+
+class EepromI2CWriteBehind : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        // Drain anything a previous test left queued before starting afresh
+        eeprom_driver_flush();
+        MockI2CEeprom::Instance().reset_instance();
+    }
+};
+
+TEST_F(EepromI2CWriteBehind, WritesAreQueued) {
+    auto& inst = MockI2CEeprom::Instance();
+    eeprom_write_dword((uint32_t*)PAGE(1), 0x12345678);
+    EXPECT_EQ(inst.page_writes(), 0);
+    EXPECT_EQ(inst.time_waited(), 0);
+
+    // Served from the queue without touching the device
+    EXPECT_EQ(eeprom_read_dword((const uint32_t*)PAGE(1)), 0x12345678);
+    EXPECT_EQ(inst.reads(), 0);
+
+    eeprom_driver_task();
+    EXPECT_EQ(inst.page_writes(), 1);
+    EXPECT_EQ(inst.get(EXTERNAL_EEPROM_PAGE_SIZE), 0x78);
+    EXPECT_EQ(inst.time_waited(), 0);
+}
+
+TEST_F(EepromI2CWriteBehind, TaskPollsTheDeviceInsteadOfWaiting) {
+    auto& inst = MockI2CEeprom::Instance();
+    eeprom_write_byte((uint8_t*)PAGE(0), 0x11);
+    eeprom_write_byte((uint8_t*)PAGE(2), 0x22);
+
+    eeprom_driver_task();
+    EXPECT_EQ(inst.page_writes(), 1);
+
+    // The device is still writing the first page
+    for (int i = 0; i < EXTERNAL_EEPROM_WRITE_TIME; ++i) {
+        eeprom_driver_task();
+        EXPECT_EQ(inst.page_writes(), 1);
+        inst.advance_time(1);
+    }
+    EXPECT_GT(inst.nacks(), 0);
+
+    eeprom_driver_task();
+    EXPECT_EQ(inst.page_writes(), 2);
+    EXPECT_EQ(inst.get(2 * EXTERNAL_EEPROM_PAGE_SIZE), 0x22);
+    EXPECT_EQ(inst.time_waited(), 0);
+}
+
+TEST_F(EepromI2CWriteBehind, WritesToAPageAreCoalesced) {
+    auto& inst = MockI2CEeprom::Instance();
+    eeprom_write_word((uint16_t*)PAGE(1), 0x1111);
+    eeprom_write_word((uint16_t*)((uintptr_t)PAGE(1) + 2), 0x2222);
+    eeprom_write_byte((uint8_t*)PAGE(1), 0x33);
+
+    eeprom_driver_task();
+    inst.advance_time(EXTERNAL_EEPROM_WRITE_TIME);
+    eeprom_driver_task();
+    EXPECT_EQ(inst.page_writes(), 1);
+    EXPECT_EQ(inst.get(EXTERNAL_EEPROM_PAGE_SIZE + 0), 0x33);
+    EXPECT_EQ(inst.get(EXTERNAL_EEPROM_PAGE_SIZE + 1), 0x11);
+    EXPECT_EQ(inst.get(EXTERNAL_EEPROM_PAGE_SIZE + 3), 0x22);
+}
+
+TEST_F(EepromI2CWriteBehind, SeparateRunsLeaveTheGapUntouched) {
+    auto& inst = MockI2CEeprom::Instance();
+    inst.set(EXTERNAL_EEPROM_PAGE_SIZE + 2, 0x5A);
+    eeprom_write_byte((uint8_t*)PAGE(1), 0x01);
+    eeprom_write_byte((uint8_t*)((uintptr_t)PAGE(1) + 4), 0x04);
+
+    eeprom_driver_flush();
+    EXPECT_EQ(inst.page_writes(), 2);
+    EXPECT_EQ(inst.get(EXTERNAL_EEPROM_PAGE_SIZE + 0), 0x01);
+    EXPECT_EQ(inst.get(EXTERNAL_EEPROM_PAGE_SIZE + 2), 0x5A);
+    EXPECT_EQ(inst.get(EXTERNAL_EEPROM_PAGE_SIZE + 4), 0x04);
+}
+
+TEST_F(EepromI2CWriteBehind, ReadsMergeQueuedAndStoredBytes) {
+    auto& inst = MockI2CEeprom::Instance();
+    for (int i = 0; i < 4; ++i) {
+        inst.set(i, 0xA0 + i);
+    }
+    eeprom_write_byte((uint8_t*)1, 0x55);
+
+    uint8_t read[4];
+    eeprom_read_block(read, PAGE(0), sizeof(read));
+    EXPECT_EQ(read[0], 0xA0);
+    EXPECT_EQ(read[1], 0x55);
+    EXPECT_EQ(read[2], 0xA2);
+    EXPECT_EQ(read[3], 0xA3);
+    EXPECT_EQ(inst.reads(), 1);
+}
+
+TEST_F(EepromI2CWriteBehind, FullQueueWritesTheOldestPage) {
+    auto& inst = MockI2CEeprom::Instance();
+    for (int page = 0; page < EXTERNAL_EEPROM_WRITE_BEHIND_PAGES; ++page) {
+        eeprom_write_byte((uint8_t*)PAGE(page), page + 1);
+    }
+    EXPECT_EQ(inst.page_writes(), 0);
+
+    eeprom_write_byte((uint8_t*)PAGE(EXTERNAL_EEPROM_WRITE_BEHIND_PAGES), 0x77);
+    EXPECT_EQ(inst.page_writes(), 1);
+    EXPECT_EQ(inst.get(0), 1);
+
+    eeprom_driver_flush();
+    for (int page = 0; page < EXTERNAL_EEPROM_WRITE_BEHIND_PAGES; ++page) {
+        EXPECT_EQ(inst.get(page * EXTERNAL_EEPROM_PAGE_SIZE), page + 1);
+    }
+    EXPECT_EQ(inst.get(EXTERNAL_EEPROM_WRITE_BEHIND_PAGES * EXTERNAL_EEPROM_PAGE_SIZE), 0x77);
+}
+
+TEST_F(EepromI2CWriteBehind, FlushOnlyWaitsAsLongAsTheDevice) {
+    auto& inst = MockI2CEeprom::Instance();
+    inst.reset_instance(2);
+    eeprom_write_byte((uint8_t*)PAGE(0), 0x01);
+    eeprom_write_byte((uint8_t*)PAGE(1), 0x02);
+
+    eeprom_driver_flush();
+    EXPECT_EQ(inst.page_writes(), 2);
+    EXPECT_FALSE(inst.busy());
+    EXPECT_EQ(inst.time_waited(), 2 * 2);
+}
+
+TEST_F(EepromI2CWriteBehind, SlowDeviceIsGivenTheDatasheetWriteTime) {
+    auto& inst = MockI2CEeprom::Instance();
+    eeprom_write_byte((uint8_t*)PAGE(0), 0x01);
+    eeprom_driver_task();
+
+    // A read of data no longer queued has to wait for the device
+    EXPECT_EQ(eeprom_read_byte((const uint8_t*)PAGE(0)), 0x01);
+    EXPECT_EQ(inst.time_waited(), EXTERNAL_EEPROM_WRITE_TIME);
+}
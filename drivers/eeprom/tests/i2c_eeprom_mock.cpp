@@ -0,0 +1,75 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "i2c_eeprom_mock.hpp"
+
+i2c_status_t MockI2CEeprom::transmit(const std::uint8_t* data, std::uint16_t length) {
+    if (busy()) {
+        ++nack_count;
+        return I2C_STATUS_ERROR;
+    }
+
+    address_pointer = 0;
+    for (int i = 0; i < EXTERNAL_EEPROM_ADDRESS_SIZE; ++i) {
+        address_pointer = (address_pointer << 8) | data[i];
+    }
+    length -= EXTERNAL_EEPROM_ADDRESS_SIZE;
+    if (length == 0) {
+        // Address only, a read follows
+        return I2C_STATUS_SUCCESS;
+    }
+
+    // Page writes wrap around within the page, as on real parts
+    EXPECT_LE(length, EXTERNAL_EEPROM_PAGE_SIZE) << "Write longer than a page.";
+    std::uint32_t page = address_pointer - address_pointer % EXTERNAL_EEPROM_PAGE_SIZE;
+    for (std::uint16_t i = 0; i < length; ++i) {
+        memory[page + (address_pointer + i) % EXTERNAL_EEPROM_PAGE_SIZE] = data[EXTERNAL_EEPROM_ADDRESS_SIZE + i];
+    }
+    ++page_write_count;
+    busy_until = now + write_latency;
+    return I2C_STATUS_SUCCESS;
+}
+
+i2c_status_t MockI2CEeprom::receive(std::uint8_t* data, std::uint16_t length) {
+    if (busy()) {
+        ++nack_count;
+        return I2C_STATUS_ERROR;
+    }
+    for (std::uint16_t i = 0; i < length; ++i) {
+        data[i] = memory[(address_pointer + i) % EXTERNAL_EEPROM_BYTE_COUNT];
+    }
+    address_pointer += length;
+    ++read_count;
+    return I2C_STATUS_SUCCESS;
+}
+
+i2c_status_t MockI2CEeprom::ping() {
+    if (busy()) {
+        ++nack_count;
+        return I2C_STATUS_ERROR;
+    }
+    return I2C_STATUS_SUCCESS;
+}
+
+extern "C" {
+
+void i2c_init(void) {}
+
+i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    return MockI2CEeprom::Instance().transmit(data, length);
+}
+
+i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout) {
+    return MockI2CEeprom::Instance().receive(data, length);
+}
+
+i2c_status_t i2c_ping_address(uint8_t address, uint16_t timeout) {
+    return MockI2CEeprom::Instance().ping();
+}
+
+void wait_ms(uint32_t ms) {
+    MockI2CEeprom::Instance().wait(ms);
+}
+
+}
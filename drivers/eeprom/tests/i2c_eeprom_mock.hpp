@@ -0,0 +1,99 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+extern "C" {
+#include "i2c_master.h"
+#include "eeprom_i2c.h"
+};
+
+// Emulates an I2C EEPROM that ignores its address while a write cycle is running
+class MockI2CEeprom {
+   private:
+    MockI2CEeprom() {
+        reset_instance();
+    }
+
+    // The contents of the device
+    std::array<std::uint8_t, EXTERNAL_EEPROM_BYTE_COUNT> memory;
+    // Where the next read starts
+    std::uint32_t address_pointer;
+    // The emulated time, advanced by wait_ms() and the test
+    std::uint32_t now;
+    // How long each write cycle keeps the device busy
+    std::uint32_t write_latency;
+    // When the current write cycle ends
+    std::uint32_t busy_until;
+    // Time spent blocking in wait_ms()
+    std::uint32_t waited;
+    // The number of page writes, reads and refused transactions
+    std::uint64_t page_write_count;
+    std::uint64_t read_count;
+    std::uint64_t nack_count;
+
+   public:
+    static MockI2CEeprom& Instance() {
+        static MockI2CEeprom instance;
+        return instance;
+    }
+
+    void reset_instance(std::uint32_t latency = EXTERNAL_EEPROM_WRITE_TIME) {
+        memory.fill(0xFF);
+        address_pointer = 0;
+        now             = 0;
+        write_latency   = latency;
+        busy_until      = 0;
+        reset_counters();
+    }
+
+    void reset_counters() {
+        waited           = 0;
+        page_write_count = 0;
+        read_count       = 0;
+        nack_count       = 0;
+    }
+
+    void advance_time(std::uint32_t ms) {
+        now += ms;
+    }
+
+    void wait(std::uint32_t ms) {
+        now += ms;
+        waited += ms;
+    }
+
+    bool busy() const {
+        return now < busy_until;
+    }
+
+    std::uint8_t get(std::uint32_t addr) const {
+        return memory[addr];
+    }
+
+    void set(std::uint32_t addr, std::uint8_t value) {
+        memory[addr] = value;
+    }
+
+    std::uint32_t time_waited() const {
+        return waited;
+    }
+
+    std::uint64_t page_writes() const {
+        return page_write_count;
+    }
+
+    std::uint64_t reads() const {
+        return read_count;
+    }
+
+    std::uint64_t nacks() const {
+        return nack_count;
+    }
+
+    i2c_status_t transmit(const std::uint8_t* data, std::uint16_t length);
+    i2c_status_t receive(std::uint8_t* data, std::uint16_t length);
+    i2c_status_t ping();
+};
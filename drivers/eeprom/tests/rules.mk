@@ -0,0 +1,33 @@
+eeprom_i2c_common_DEFS := \
+	-DEEPROM_DRIVER \
+	-DEEPROM_I2C \
+	-DEXTERNAL_EEPROM_BYTE_COUNT=256 \
+	-DEXTERNAL_EEPROM_PAGE_SIZE=16 \
+	-DEXTERNAL_EEPROM_ADDRESS_SIZE=1 \
+	-DEXTERNAL_EEPROM_WRITE_TIME=5
+eeprom_i2c_common_SRC := \
+	$(DRIVER_PATH)/eeprom/eeprom_driver.c \
+	$(DRIVER_PATH)/eeprom/eeprom_i2c.c \
+	$(DRIVER_PATH)/eeprom/tests/i2c_eeprom_mock.cpp
+eeprom_i2c_common_INC := \
+	$(DRIVER_PATH) \
+	$(DRIVER_PATH)/eeprom \
+	$(DRIVER_PATH)/eeprom/tests
+
+eeprom_i2c_DEFS := \
+	$(eeprom_i2c_common_DEFS)
+eeprom_i2c_SRC := \
+	$(eeprom_i2c_common_SRC) \
+	$(DRIVER_PATH)/eeprom/tests/eeprom_i2c.cpp
+eeprom_i2c_INC := \
+	$(eeprom_i2c_common_INC)
+
+eeprom_i2c_write_behind_DEFS := \
+	$(eeprom_i2c_common_DEFS) \
+	-DEXTERNAL_EEPROM_WRITE_BEHIND \
+	-DEXTERNAL_EEPROM_WRITE_BEHIND_PAGES=2
+eeprom_i2c_write_behind_SRC := \
+	$(eeprom_i2c_common_SRC) \
+	$(DRIVER_PATH)/eeprom/tests/eeprom_i2c_write_behind.cpp
+eeprom_i2c_write_behind_INC := \
+	$(eeprom_i2c_common_INC)
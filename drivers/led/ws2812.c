@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "ws2812.h"
+#include <string.h>
 
 #if defined(WS2812_RGBW)
 void ws2812_rgb_to_rgbw(ws2812_led_t *led) {
@@ -13,3 +14,33 @@ void ws2812_rgb_to_rgbw(ws2812_led_t *led) {
     led->b -= led->w;
 }
 #endif
+
+// One past the last LED changed since the last flush, starts out covering the
+// whole chain so the first flush overwrites whatever the LEDs power up with.
+static uint16_t ws2812_dirty_end = WS2812_LED_COUNT;
+
+void ws2812_update_led(ws2812_led_t *leds, int index, uint8_t red, uint8_t green, uint8_t blue) {
+    ws2812_led_t led = {.r = red, .g = green, .b = blue};
+#if defined(WS2812_RGBW)
+    ws2812_rgb_to_rgbw(&led);
+#endif
+
+    if (memcmp(&leds[index], &led, sizeof(led)) == 0) {
+        return;
+    }
+
+    leds[index] = led;
+    if (index >= ws2812_dirty_end) {
+        ws2812_dirty_end = index + 1;
+    }
+}
+
+void ws2812_mark_all_dirty(void) {
+    ws2812_dirty_end = WS2812_LED_COUNT;
+}
+
+uint16_t ws2812_take_dirty_count(void) {
+    uint16_t count   = ws2812_dirty_end;
+    ws2812_dirty_end = 0;
+    return count;
+}
@@ -95,3 +95,24 @@ void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue);
 void ws2812_flush(void);
 
 void ws2812_rgb_to_rgbw(ws2812_led_t *led);
+
+/**
+ * \brief Stores a colour in `leds[index]`, tracking changed LEDs for
+ * ws2812_take_dirty_count().
+ */
+void ws2812_update_led(ws2812_led_t *leds, int index, uint8_t red, uint8_t green, uint8_t blue);
+
+/**
+ * \brief Makes the next flush send the whole chain, drivers call this from
+ * ws2812_init().
+ */
+void ws2812_mark_all_dirty(void);
+
+/**
+ * \brief Returns how many LEDs from the start of the chain have to be sent
+ * to show every change since the last call, 0 if nothing changed.
+ *
+ * Colours shift down the chain and latch on reset, so LEDs past the returned
+ * count keep showing what they were last sent.
+ */
+uint16_t ws2812_take_dirty_count(void);
@@ -167,6 +167,13 @@ uint32_t oled_scroll_timeout;
 #if OLED_UPDATE_INTERVAL > 0
 uint16_t oled_update_timeout;
 #endif
+#ifdef OLED_DIRTY_BYTE_RANGES
+// Range of changed bytes within each dirty block. Blocks which are dirty without a range, such as after clearing the
+// display, are rendered in full.
+static OLED_BLOCK_TYPE oled_dirty_ranged = 0;
+static uint16_t        oled_dirty_first[OLED_BLOCK_COUNT];
+static uint16_t        oled_dirty_last[OLED_BLOCK_COUNT];
+#endif
 
 #if defined(OLED_TRANSPORT_SPI)
 #    ifndef OLED_DC_PIN
@@ -276,6 +283,40 @@ __attribute__((weak)) void oled_driver_init(void) {
 #endif
 }
 
+// Marks the blocks containing the buffer indices between first and last (inclusive) as dirty
+static void oled_mark_dirty(uint16_t first, uint16_t last) {
+    for (uint8_t block = first / OLED_BLOCK_SIZE; block <= last / OLED_BLOCK_SIZE; ++block) {
+        const OLED_BLOCK_TYPE block_mask = (OLED_BLOCK_TYPE)1 << block;
+#ifdef OLED_DIRTY_BYTE_RANGES
+        const uint16_t block_start = OLED_BLOCK_SIZE * block;
+        const uint16_t block_end   = block_start + OLED_BLOCK_SIZE - 1;
+        const uint16_t range_first = (first > block_start ? first : block_start) - block_start;
+        const uint16_t range_last  = (last < block_end ? last : block_end) - block_start;
+        if (!(oled_dirty & block_mask)) {
+            oled_dirty_ranged |= block_mask;
+            oled_dirty_first[block] = range_first;
+            oled_dirty_last[block]  = range_last;
+        } else if (oled_dirty_ranged & block_mask) {
+            if (range_first < oled_dirty_first[block]) {
+                oled_dirty_first[block] = range_first;
+            }
+            if (range_last > oled_dirty_last[block]) {
+                oled_dirty_last[block] = range_last;
+            }
+        }
+#endif
+        oled_dirty |= block_mask;
+    }
+}
+
+// Marks the entire display as dirty
+static void oled_mark_all_dirty(void) {
+    oled_dirty = OLED_ALL_BLOCKS_MASK;
+#ifdef OLED_DIRTY_BYTE_RANGES
+    oled_dirty_ranged = 0;
+#endif
+}
+
 // Flips the rendering bits for a character at the current cursor position
 static void InvertCharacter(uint8_t *cursor) {
     const uint8_t *end = cursor + OLED_FONT_WIDTH;
@@ -381,7 +422,7 @@ __attribute__((weak)) oled_rotation_t oled_init_user(oled_rotation_t rotation) {
 void oled_clear(void) {
     memset(oled_buffer, 0, sizeof(oled_buffer));
     oled_cursor = &oled_buffer[0];
-    oled_dirty  = OLED_ALL_BLOCKS_MASK;
+    oled_mark_all_dirty();
 }
 
 static void calc_bounds(uint8_t update_start, uint8_t *cmd_array) {
@@ -403,7 +444,7 @@ static void calc_bounds(uint8_t update_start, uint8_t *cmd_array) {
 #endif
 }
 
-static void calc_bounds_90(uint8_t update_start, uint8_t *cmd_array) {
+static void calc_origin_90(uint8_t update_start, uint8_t *start_page, uint8_t *start_column) {
     // Block numbering starts from the bottom left corner, going up and then to
     // the right.  The controller needs the page and column numbers for the top
     // left and bottom right corners of that block.
@@ -418,21 +459,43 @@ static void calc_bounds_90(uint8_t update_start, uint8_t *cmd_array) {
     // Top page number for a block which is at the bottom edge of the screen.
     const uint8_t bottom_block_top_page = (height_in_pages - page_inc_per_block) % height_in_pages;
 
+    *start_page   = bottom_block_top_page - (OLED_BLOCK_SIZE * update_start % OLED_DISPLAY_HEIGHT / 8);
+    *start_column = OLED_BLOCK_SIZE * update_start / OLED_DISPLAY_HEIGHT * 8;
+}
+
+static void calc_bounds_90(uint8_t update_start, uint8_t *cmd_array) {
+    uint8_t start_page, start_column;
+    calc_origin_90(update_start, &start_page, &start_column);
+
 #if !OLED_IC_HAS_HORIZONTAL_MODE
     // Only the Page Addressing Mode is supported
-    uint8_t start_page   = bottom_block_top_page - (OLED_BLOCK_SIZE * update_start % OLED_DISPLAY_HEIGHT / 8);
-    uint8_t start_column = OLED_BLOCK_SIZE * update_start / OLED_DISPLAY_HEIGHT * 8;
-    cmd_array[0]         = PAM_PAGE_ADDR | start_page;
-    cmd_array[1]         = PAM_SETCOLUMN_LSB | ((OLED_COLUMN_OFFSET + start_column) & 0x0f);
-    cmd_array[2]         = PAM_SETCOLUMN_MSB | ((OLED_COLUMN_OFFSET + start_column) >> 4 & 0x0f);
+    cmd_array[0] = PAM_PAGE_ADDR | start_page;
+    cmd_array[1] = PAM_SETCOLUMN_LSB | ((OLED_COLUMN_OFFSET + start_column) & 0x0f);
+    cmd_array[2] = PAM_SETCOLUMN_MSB | ((OLED_COLUMN_OFFSET + start_column) >> 4 & 0x0f);
 #else
-    cmd_array[1] = OLED_BLOCK_SIZE * update_start / OLED_DISPLAY_HEIGHT * 8 + OLED_COLUMN_OFFSET;
-    cmd_array[4] = bottom_block_top_page - (OLED_BLOCK_SIZE * update_start % OLED_DISPLAY_HEIGHT / 8);
+    cmd_array[1] = start_column + OLED_COLUMN_OFFSET;
+    cmd_array[4] = start_page;
     cmd_array[2] = (OLED_BLOCK_SIZE + OLED_DISPLAY_HEIGHT - 1) / OLED_DISPLAY_HEIGHT * 8 - 1 + cmd_array[1];
     cmd_array[5] = (OLED_BLOCK_SIZE + OLED_DISPLAY_HEIGHT - 1) % OLED_DISPLAY_HEIGHT / 8 + cmd_array[4];
 #endif
 }
 
+#ifdef OLED_DIRTY_BYTE_RANGES
+static void calc_window(uint8_t page, uint8_t column, uint8_t width, uint8_t *cmd_array) {
+    // Calculate commands to set memory addressing bounds for a run of columns within a single page.
+#    if !OLED_IC_HAS_HORIZONTAL_MODE
+    cmd_array[0] = PAM_PAGE_ADDR | page;
+    cmd_array[1] = PAM_SETCOLUMN_LSB | ((OLED_COLUMN_OFFSET + column) & 0x0f);
+    cmd_array[2] = PAM_SETCOLUMN_MSB | ((OLED_COLUMN_OFFSET + column) >> 4 & 0x0f);
+#    else
+    cmd_array[1] = column + OLED_COLUMN_OFFSET;
+    cmd_array[2] = cmd_array[1] + width - 1;
+    cmd_array[4] = page;
+    cmd_array[5] = page;
+#    endif
+}
+#endif
+
 uint8_t crot(uint8_t a, int8_t n) {
     const uint8_t mask = 0x7;
     n &= mask;
@@ -440,14 +503,72 @@ uint8_t crot(uint8_t a, int8_t n) {
 }
 
 static void rotate_90(const uint8_t *src, uint8_t *dest) {
-    for (uint8_t i = 0, shift = 7; i < 8; ++i, --shift) {
-        uint8_t selector = (1 << i);
+    // Bit i of src[j] becomes bit (7 - j) of dest[i], shifting in one source byte at a time avoids variable shifts
+    uint8_t selector = 1;
+    for (uint8_t i = 0; i < 8; ++i, selector <<= 1) {
+        uint8_t column = 0;
         for (uint8_t j = 0; j < 8; ++j) {
-            dest[i] |= crot(src[j] & selector, shift - (int8_t)j);
+            column = (column << 1) | ((src[j] & selector) ? 1 : 0);
         }
+        dest[i] |= column;
     }
 }
 
+#ifdef OLED_DIRTY_BYTE_RANGES
+// Sends just the changed bytes of a block, returning false if the entire block needs to be rendered instead
+static bool render_dirty_range(uint8_t update_start) {
+#    if OLED_IC_HAS_HORIZONTAL_MODE
+    uint8_t display_window[] = {I2C_CMD, COLUMN_ADDR, 0, 0, PAGE_ADDR, 0, 0};
+#    else
+    uint8_t display_window[] = {I2C_CMD, PAM_PAGE_ADDR, PAM_SETCOLUMN_LSB, PAM_SETCOLUMN_MSB};
+#    endif
+    const uint16_t block_start = OLED_BLOCK_SIZE * update_start;
+    const uint16_t range_first = oled_dirty_first[update_start];
+    const uint16_t range_last  = oled_dirty_last[update_start];
+
+    if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
+        // Bytes map directly onto consecutive columns, as long as the range doesn't cross into the next page
+        const uint16_t first = block_start + range_first;
+        const uint16_t last  = block_start + range_last;
+        if (first / OLED_DISPLAY_WIDTH != last / OLED_DISPLAY_WIDTH) {
+            return false;
+        }
+        calc_window(first / OLED_DISPLAY_WIDTH, first % OLED_DISPLAY_WIDTH, last - first + 1, &display_window[1]);
+        return oled_send_cmd(display_window, ARRAY_SIZE(display_window)) && oled_send_data(&oled_buffer[first], last - first + 1);
+    }
+
+    // Each 8x8 tile of the block is rotated into 8 columns of a single page, only send the tiles which have changed
+    static const uint8_t source_map[]     = OLED_SOURCE_MAP;
+    static const uint8_t target_map[]     = OLED_TARGET_MAP;
+    const uint8_t        columns_in_block = (OLED_BLOCK_SIZE + OLED_DISPLAY_HEIGHT - 1) / OLED_DISPLAY_HEIGHT * 8;
+
+    uint8_t dirty_tiles = 0;
+    for (uint8_t i = 0; i < sizeof(source_map); ++i) {
+        if (source_map[i] <= range_last && source_map[i] + 7 >= range_first) {
+            ++dirty_tiles;
+        }
+    }
+    if (dirty_tiles * (8 + sizeof(display_window)) >= OLED_BLOCK_SIZE + sizeof(display_window)) {
+        return false;
+    }
+
+    uint8_t start_page, start_column;
+    calc_origin_90(update_start, &start_page, &start_column);
+    for (uint8_t i = 0; i < sizeof(source_map); ++i) {
+        if (source_map[i] > range_last || source_map[i] + 7 < range_first) {
+            continue;
+        }
+        uint8_t tile[8] = {0};
+        rotate_90(&oled_buffer[block_start + source_map[i]], tile);
+        calc_window(start_page + target_map[i] / columns_in_block, start_column + target_map[i] % columns_in_block, sizeof(tile), &display_window[1]);
+        if (!oled_send_cmd(display_window, ARRAY_SIZE(display_window)) || !oled_send_data(tile, sizeof(tile))) {
+            return false;
+        }
+    }
+    return true;
+}
+#endif
+
 void oled_render_dirty(bool all) {
     // Do we have work to do?
     oled_dirty &= OLED_ALL_BLOCKS_MASK;
@@ -466,6 +587,15 @@ void oled_render_dirty(bool all) {
             ++update_start;
         }
 
+#ifdef OLED_DIRTY_BYTE_RANGES
+        // Send only the changed bytes if possible, otherwise fall back to rendering the entire block
+        if ((oled_dirty_ranged & ((OLED_BLOCK_TYPE)1 << update_start)) && render_dirty_range(update_start)) {
+            oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
+            oled_dirty_ranged &= ~((OLED_BLOCK_TYPE)1 << update_start);
+            continue;
+        }
+#endif
+
         // Set column & page position
 #if OLED_IC_HAS_HORIZONTAL_MODE
         static uint8_t display_start[] = {I2C_CMD, COLUMN_ADDR, 0, OLED_DISPLAY_WIDTH - 1, PAGE_ADDR, 0, OLED_DISPLAY_HEIGHT / 8 - 1};
@@ -531,6 +661,9 @@ void oled_render_dirty(bool all) {
 
         // Clear dirty flag of just rendered block
         oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
+#ifdef OLED_DIRTY_BYTE_RANGES
+        oled_dirty_ranged &= ~((OLED_BLOCK_TYPE)1 << update_start);
+#endif
     }
 }
 
@@ -622,9 +755,8 @@ void oled_write_char(const char data, bool invert) {
     // Dirty check
     if (memcmp(&oled_temp_buffer, oled_cursor, OLED_FONT_WIDTH)) {
         uint16_t index = oled_cursor - &oled_buffer[0];
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
-        // Edgecase check if the written data spans the 2 chunks
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << ((index + OLED_FONT_WIDTH - 1) / OLED_BLOCK_SIZE));
+        // The written data may span 2 chunks
+        oled_mark_dirty(index, index + OLED_FONT_WIDTH - 1);
     }
 
     // Finally move to the next char
@@ -659,7 +791,7 @@ void oled_pan(bool left) {
             }
         }
     }
-    oled_dirty = OLED_ALL_BLOCKS_MASK;
+    oled_mark_all_dirty();
 }
 
 oled_buffer_reader_t oled_read_raw(uint16_t start_index) {
@@ -674,7 +806,7 @@ void oled_write_raw_byte(const char data, uint16_t index) {
     if (index > OLED_MATRIX_SIZE) index = OLED_MATRIX_SIZE;
     if (oled_buffer[index] == data) return;
     oled_buffer[index] = data;
-    oled_dirty |= ((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
+    oled_mark_dirty(index, index);
 }
 
 void oled_write_raw(const char *data, uint16_t size) {
@@ -684,7 +816,7 @@ void oled_write_raw(const char *data, uint16_t size) {
         uint8_t c = *data++;
         if (oled_buffer[i] == c) continue;
         oled_buffer[i] = c;
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (i / OLED_BLOCK_SIZE));
+        oled_mark_dirty(i, i);
     }
 }
 
@@ -704,7 +836,7 @@ void oled_write_pixel(uint8_t x, uint8_t y, bool on) {
     }
     if (oled_buffer[index] != data) {
         oled_buffer[index] = data;
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
+        oled_mark_dirty(index, index);
     }
 }
 
@@ -729,7 +861,7 @@ void oled_write_raw_P(const char *data, uint16_t size) {
         uint8_t c = pgm_read_byte(data++);
         if (oled_buffer[i] == c) continue;
         oled_buffer[i] = c;
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (i / OLED_BLOCK_SIZE));
+        oled_mark_dirty(i, i);
     }
 }
 #endif // defined(__AVR__)
@@ -879,7 +1011,7 @@ bool oled_scroll_off(void) {
             return oled_scrolling;
         }
         oled_scrolling = false;
-        oled_dirty     = OLED_ALL_BLOCKS_MASK;
+        oled_mark_all_dirty();
     }
     return !oled_scrolling;
 }
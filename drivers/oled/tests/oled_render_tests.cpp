@@ -0,0 +1,152 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <random>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "i2c_master.h"
+#include "oled_driver.h"
+
+extern uint8_t         oled_buffer[OLED_MATRIX_SIZE];
+extern OLED_BLOCK_TYPE oled_dirty;
+}
+
+// Display memory of the controller, as written over I2C
+struct display_memory_t {
+    uint8_t data[16][256];
+};
+
+static display_memory_t display_memory;
+static uint8_t          window_first_column, window_last_column, window_first_page, window_last_page;
+static uint8_t          column, page;
+static uint32_t         data_bytes_sent;
+
+void i2c_init(void) {}
+
+// Commands, only the ones setting the address window matter here
+i2c_status_t i2c_transmit(uint8_t address, const uint8_t *data, uint16_t size, uint16_t timeout) {
+    if (size == 7 && data[1] == 0x21) {
+        // Horizontal addressing, column and page range
+        window_first_column = data[2];
+        window_last_column  = data[3];
+        window_first_page   = data[5];
+        window_last_page    = data[6];
+        column              = window_first_column;
+        page                = window_first_page;
+    } else if (size == 4 && (data[1] & 0xF0) == 0xB0) {
+        // Page addressing, start page and column only
+        page                = data[1] & 0x0F;
+        column              = (data[2] & 0x0F) | (data[3] & 0x0F) << 4;
+        window_first_column = 0;
+        window_last_column  = 0xFF;
+        window_first_page   = 0;
+        window_last_page    = 0x0F;
+    }
+    return I2C_STATUS_SUCCESS;
+}
+
+// Display data, written from the current address on
+i2c_status_t i2c_write_register(uint8_t address, uint8_t reg, const uint8_t *data, uint16_t size, uint16_t timeout) {
+    data_bytes_sent += size;
+    for (uint16_t i = 0; i < size; i++) {
+        display_memory.data[page][column] = data[i];
+        if (column++ == window_last_column) {
+            column = window_first_column;
+            page   = page == window_last_page ? window_first_page : page + 1;
+        }
+    }
+    return I2C_STATUS_SUCCESS;
+}
+
+class OledRender : public ::testing::TestWithParam<oled_rotation_t> {
+   protected:
+    void SetUp() override {
+        oled_init(GetParam());
+        oled_render_dirty(true);
+    }
+
+    // Renders the whole buffer from scratch, as after oled_clear()
+    display_memory_t full_render() {
+        const display_memory_t rendered = display_memory;
+        uint8_t                buffer[OLED_MATRIX_SIZE];
+
+        memcpy(buffer, oled_buffer, sizeof(buffer));
+        memset(&display_memory, 0, sizeof(display_memory));
+        oled_clear();
+        memcpy(oled_buffer, buffer, sizeof(buffer));
+        oled_render_dirty(true);
+
+        const display_memory_t full = display_memory;
+        display_memory              = rendered;
+        return full;
+    }
+
+    void random_update(std::mt19937 &rng) {
+        const bool    rotated = GetParam() & OLED_ROTATION_90;
+        const uint8_t width   = rotated ? OLED_DISPLAY_HEIGHT : OLED_DISPLAY_WIDTH;
+        const uint8_t height  = rotated ? OLED_DISPLAY_WIDTH : OLED_DISPLAY_HEIGHT;
+
+        const uint32_t op = rng() % 100;
+        if (op < 60) {
+            oled_write_pixel(rng() % width, rng() % height, rng() & 1);
+        } else if (op < 80) {
+            oled_set_cursor(rng() % oled_max_chars(), rng() % oled_max_lines());
+            oled_write_char('A' + rng() % 26, rng() & 1);
+        } else if (op < 99) {
+            oled_write_raw_byte(rng() & 0xFF, rng() % OLED_MATRIX_SIZE);
+        } else {
+            oled_clear();
+        }
+    }
+};
+
+TEST_P(OledRender, partial_renders_match_a_full_render) {
+    std::mt19937 rng(GetParam() + 1);
+
+    for (int step = 0; step < 4000; step++) {
+        random_update(rng);
+        if (rng() % 5 == 0) {
+            oled_render_dirty(rng() & 1);
+        }
+        if (step % 200 == 199) {
+            oled_render_dirty(true);
+            const display_memory_t full = full_render();
+            ASSERT_EQ(memcmp(&display_memory, &full, sizeof(display_memory)), 0) << "at step " << step;
+        }
+    }
+}
+
+TEST_P(OledRender, unrotated_display_memory_matches_the_buffer) {
+    if (GetParam() & OLED_ROTATION_90) {
+        GTEST_SKIP() << "Rotated by the driver while rendering";
+    }
+    std::mt19937 rng(GetParam() + 1);
+
+    for (int step = 0; step < 1000; step++) {
+        random_update(rng);
+    }
+    oled_render_dirty(true);
+
+    for (uint16_t i = 0; i < OLED_MATRIX_SIZE; i++) {
+        ASSERT_EQ(display_memory.data[i / OLED_DISPLAY_WIDTH][OLED_COLUMN_OFFSET + i % OLED_DISPLAY_WIDTH], oled_buffer[i]) << "at index " << i;
+    }
+}
+
+TEST_P(OledRender, single_byte_change_is_sent) {
+    data_bytes_sent = 0;
+    oled_write_raw_byte(0x5A, OLED_BLOCK_SIZE + 1);
+    oled_render_dirty(true);
+
+    EXPECT_EQ(oled_dirty, 0);
+#ifdef OLED_DIRTY_BYTE_RANGES
+    // Only the changed byte, or its 8x8 tile when rotated
+    EXPECT_LT(data_bytes_sent, (uint32_t)OLED_BLOCK_SIZE);
+#else
+    EXPECT_EQ(data_bytes_sent, (uint32_t)OLED_BLOCK_SIZE);
+#endif
+}
+
+INSTANTIATE_TEST_CASE_P(Rotations, OledRender, ::testing::Values(OLED_ROTATION_0, OLED_ROTATION_90, OLED_ROTATION_180, OLED_ROTATION_270));
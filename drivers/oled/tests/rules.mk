@@ -0,0 +1,77 @@
+oled_common_DEFS := \
+	-DOLED_ENABLE \
+	-DOLED_TRANSPORT_I2C \
+	-DOLED_TIMEOUT=0 \
+	-DOLED_UPDATE_PROCESS_LIMIT=3
+oled_common_SRC := \
+	platforms/test/timer.c \
+	$(DRIVER_PATH)/oled/oled_driver.c \
+	$(DRIVER_PATH)/oled/tests/oled_render_tests.cpp
+oled_common_INC := \
+	$(DRIVER_PATH)/oled
+
+oled_128x32_DEFS := \
+	$(oled_common_DEFS) \
+	-DOLED_DISPLAY_128X32
+oled_128x32_SRC := $(oled_common_SRC)
+oled_128x32_INC := $(oled_common_INC)
+
+oled_128x32_dirty_byte_ranges_DEFS := \
+	$(oled_128x32_DEFS) \
+	-DOLED_DIRTY_BYTE_RANGES
+oled_128x32_dirty_byte_ranges_SRC := $(oled_common_SRC)
+oled_128x32_dirty_byte_ranges_INC := $(oled_common_INC)
+
+oled_128x64_uint8_DEFS := \
+	$(oled_common_DEFS) \
+	-DOLED_DISPLAY_128X64 \
+	-DOLED_BLOCK_TYPE=uint8_t
+oled_128x64_uint8_SRC := $(oled_common_SRC)
+oled_128x64_uint8_INC := $(oled_common_INC)
+
+oled_128x64_uint8_dirty_byte_ranges_DEFS := \
+	$(oled_128x64_uint8_DEFS) \
+	-DOLED_DIRTY_BYTE_RANGES
+oled_128x64_uint8_dirty_byte_ranges_SRC := $(oled_common_SRC)
+oled_128x64_uint8_dirty_byte_ranges_INC := $(oled_common_INC)
+
+oled_128x64_uint32_DEFS := \
+	$(oled_common_DEFS) \
+	-DOLED_DISPLAY_128X64 \
+	-DOLED_BLOCK_TYPE=uint32_t \
+	'-DOLED_SOURCE_MAP={0,8,16,24}' \
+	'-DOLED_TARGET_MAP={24,16,8,0}'
+oled_128x64_uint32_SRC := $(oled_common_SRC)
+oled_128x64_uint32_INC := $(oled_common_INC)
+
+oled_128x64_uint32_dirty_byte_ranges_DEFS := \
+	$(oled_128x64_uint32_DEFS) \
+	-DOLED_DIRTY_BYTE_RANGES
+oled_128x64_uint32_dirty_byte_ranges_SRC := $(oled_common_SRC)
+oled_128x64_uint32_dirty_byte_ranges_INC := $(oled_common_INC)
+
+oled_sh1106_128x64_DEFS := \
+	$(oled_common_DEFS) \
+	-DOLED_DISPLAY_128X64 \
+	-DOLED_IC=OLED_IC_SH1106 \
+	-DOLED_COLUMN_OFFSET=2
+oled_sh1106_128x64_SRC := $(oled_common_SRC)
+oled_sh1106_128x64_INC := $(oled_common_INC)
+
+oled_sh1106_128x64_dirty_byte_ranges_DEFS := \
+	$(oled_sh1106_128x64_DEFS) \
+	-DOLED_DIRTY_BYTE_RANGES
+oled_sh1106_128x64_dirty_byte_ranges_SRC := $(oled_common_SRC)
+oled_sh1106_128x64_dirty_byte_ranges_INC := $(oled_common_INC)
+
+oled_64x48_DEFS := \
+	$(oled_common_DEFS) \
+	-DOLED_DISPLAY_64X48
+oled_64x48_SRC := $(oled_common_SRC)
+oled_64x48_INC := $(oled_common_INC)
+
+oled_64x48_dirty_byte_ranges_DEFS := \
+	$(oled_64x48_DEFS) \
+	-DOLED_DIRTY_BYTE_RANGES
+oled_64x48_dirty_byte_ranges_SRC := $(oled_common_SRC)
+oled_64x48_dirty_byte_ranges_INC := $(oled_common_INC)
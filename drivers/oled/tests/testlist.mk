@@ -0,0 +1,11 @@
+TEST_LIST += \
+	oled_128x32 \
+	oled_128x32_dirty_byte_ranges \
+	oled_128x64_uint8 \
+	oled_128x64_uint8_dirty_byte_ranges \
+	oled_128x64_uint32 \
+	oled_128x64_uint32_dirty_byte_ranges \
+	oled_sh1106_128x64 \
+	oled_sh1106_128x64_dirty_byte_ranges \
+	oled_64x48 \
+	oled_64x48_dirty_byte_ranges
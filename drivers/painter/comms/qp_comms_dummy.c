@@ -24,11 +24,18 @@ uint32_t dummy_comms_send(painter_device_t device, const void *data, uint32_t by
     return byte_count;
 }
 
+static bool dummy_comms_send_async(painter_device_t device, const void *data, uint32_t byte_count, painter_driver_comms_complete_func complete) {
+    // No-op, completes immediately.
+    complete(device);
+    return true;
+}
+
 painter_comms_vtable_t dummy_comms_vtable = {
     // These are all effective no-op's because they're not actually needed.
-    .comms_init  = dummy_comms_init,
-    .comms_start = dummy_comms_start,
-    .comms_stop  = dummy_comms_stop,
-    .comms_send  = dummy_comms_send};
+    .comms_init       = dummy_comms_init,
+    .comms_start      = dummy_comms_start,
+    .comms_stop       = dummy_comms_stop,
+    .comms_send       = dummy_comms_send,
+    .comms_send_async = dummy_comms_send_async};
 
 #endif // QUANTUM_PAINTER_DUMMY_COMMS_ENABLE
@@ -21,6 +21,15 @@
 #    define SURFACE_NUM_DEVICES 1
 #endif
 
+#ifndef SURFACE_DIRTY_RECT_COUNT
+/**
+ * @def This controls the maximum number of disjoint dirty rectangles tracked by each surface. Each one is transferred
+ *      with its own viewport by qp_surface_draw(), so that areas drawn far apart do not require the space in between
+ *      to be sent as well. Setting this to 1 tracks a single bounding box of all drawing.
+ */
+#    define SURFACE_DIRTY_RECT_COUNT 4
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Forward declarations
 
@@ -29,6 +29,45 @@ void qp_surface_increment_pixdata_location(surface_viewport_data_t *viewport) {
     }
 }
 
+static inline uint32_t qp_surface_rect_area(uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+    return (uint32_t)(r - l + 1) * (uint32_t)(b - t + 1);
+}
+
+static inline bool qp_surface_rect_contains(const surface_dirty_rect_t *rect, uint16_t x, uint16_t y) {
+    return x >= rect->l && x <= rect->r && y >= rect->t && y <= rect->b;
+}
+
+static inline bool qp_surface_rects_overlap(const surface_dirty_rect_t *a, const surface_dirty_rect_t *b) {
+    return a->l <= b->r && b->l <= a->r && a->t <= b->b && b->t <= a->b;
+}
+
+// Keeps the dirty rectangles disjoint after the rectangle at `index` has grown, absorbing any it now overlaps
+static void qp_surface_merge_overlapping(surface_dirty_data_t *dirty, uint8_t index) {
+    bool merged;
+    do {
+        merged = false;
+        for (uint8_t i = 0; i < dirty->rect_count; ++i) {
+            if (i == index || !qp_surface_rects_overlap(&dirty->rects[index], &dirty->rects[i])) {
+                continue;
+            }
+
+            // Grow to cover both, then fill the gap with the last rectangle
+            surface_dirty_rect_t *rect = &dirty->rects[index];
+            rect->l                    = QP_MIN(rect->l, dirty->rects[i].l);
+            rect->t                    = QP_MIN(rect->t, dirty->rects[i].t);
+            rect->r                    = QP_MAX(rect->r, dirty->rects[i].r);
+            rect->b                    = QP_MAX(rect->b, dirty->rects[i].b);
+            dirty->rects[i]            = dirty->rects[--dirty->rect_count];
+            if (index == dirty->rect_count) {
+                index = i;
+            }
+            merged = true;
+            break;
+        }
+    } while (merged);
+    dirty->last_rect = index;
+}
+
 void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y) {
     // Maintain dirty region
     if (dirty->l > x) {
@@ -47,6 +86,54 @@ void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y
         dirty->b        = y;
         dirty->is_dirty = true;
     }
+
+    // Consecutive pixels usually land in the same rectangle
+    if (dirty->rect_count > 0 && qp_surface_rect_contains(&dirty->rects[dirty->last_rect], x, y)) {
+        return;
+    }
+
+    // Find the rectangle which needs the least extra area to cover this pixel
+    uint8_t  best        = 0;
+    uint32_t best_area   = 0;
+    uint32_t best_growth = UINT32_MAX;
+    for (uint8_t i = 0; i < dirty->rect_count; ++i) {
+        const surface_dirty_rect_t *rect = &dirty->rects[i];
+        if (qp_surface_rect_contains(rect, x, y)) {
+            dirty->last_rect = i;
+            return;
+        }
+
+        const uint32_t area   = qp_surface_rect_area(rect->l, rect->t, rect->r, rect->b);
+        const uint32_t growth = qp_surface_rect_area(QP_MIN(rect->l, x), QP_MIN(rect->t, y), QP_MAX(rect->r, x), QP_MAX(rect->b, y)) - area;
+        if (growth < best_growth) {
+            best        = i;
+            best_area   = area;
+            best_growth = growth;
+        }
+    }
+
+    // Start a new rectangle if growing the best one would add more area than it already has, unless there's no room
+    if (dirty->rect_count == 0 || (dirty->rect_count < SURFACE_DIRTY_RECT_COUNT && best_growth > best_area + 1)) {
+        dirty->rects[dirty->rect_count] = (surface_dirty_rect_t){.l = x, .t = y, .r = x, .b = y};
+        dirty->last_rect                = dirty->rect_count++;
+        dirty->is_dirty                 = true;
+        return;
+    }
+
+    surface_dirty_rect_t *rect = &dirty->rects[best];
+    rect->l                    = QP_MIN(rect->l, x);
+    rect->t                    = QP_MIN(rect->t, y);
+    rect->r                    = QP_MAX(rect->r, x);
+    rect->b                    = QP_MAX(rect->b, y);
+    qp_surface_merge_overlapping(dirty, best);
+}
+
+void qp_surface_reset_dirty(surface_dirty_data_t *dirty) {
+    dirty->l = dirty->t = UINT16_MAX;
+    dirty->r = dirty->b = 0;
+    dirty->is_dirty     = false;
+    dirty->rect_count   = 0;
+    dirty->last_rect    = 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -57,11 +144,14 @@ bool qp_surface_init(painter_device_t device, painter_rotation_t rotation) {
     surface_painter_device_t *surface = (surface_painter_device_t *)driver;
     memset(surface->buffer, 0, SURFACE_REQUIRED_BUFFER_BYTE_SIZE(driver->panel_width, driver->panel_height, driver->native_bits_per_pixel));
 
-    surface->dirty.l        = 0;
-    surface->dirty.t        = 0;
-    surface->dirty.r        = surface->base.panel_width - 1;
-    surface->dirty.b        = surface->base.panel_height - 1;
-    surface->dirty.is_dirty = true;
+    surface->dirty.l          = 0;
+    surface->dirty.t          = 0;
+    surface->dirty.r          = surface->base.panel_width - 1;
+    surface->dirty.b          = surface->base.panel_height - 1;
+    surface->dirty.is_dirty   = true;
+    surface->dirty.rects[0]   = (surface_dirty_rect_t){.l = 0, .t = 0, .r = surface->base.panel_width - 1, .b = surface->base.panel_height - 1};
+    surface->dirty.rect_count = 1;
+    surface->dirty.last_rect  = 0;
 
     return true;
 }
@@ -80,9 +170,7 @@ bool qp_surface_clear(painter_device_t device) {
 bool qp_surface_flush(painter_device_t device) {
     painter_driver_t *        driver  = (painter_driver_t *)device;
     surface_painter_device_t *surface = (surface_painter_device_t *)driver;
-    surface->dirty.l = surface->dirty.t = UINT16_MAX;
-    surface->dirty.r = surface->dirty.b = 0;
-    surface->dirty.is_dirty             = false;
+    qp_surface_reset_dirty(&surface->dirty);
     return true;
 }
 
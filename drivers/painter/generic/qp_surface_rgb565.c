@@ -4,6 +4,7 @@
 #ifdef QUANTUM_PAINTER_SURFACE_ENABLE
 
 #    include "color.h"
+#    include "qp_comms.h"
 #    include "qp_draw.h"
 #    include "qp_surface_internal.h"
 #    include "qp_comms_dummy.h"
@@ -68,18 +69,21 @@ static bool qp_surface_append_pixels_rgb565(painter_device_t device, uint8_t *ta
     return true;
 }
 
-static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
+static bool rgb565_target_pixdata_transfer_rect(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
     surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
+    painter_device_t          target         = (painter_device_t)target_driver;
 
-    uint16_t l = entire_surface ? 0 : surface_handle->dirty.l;
-    uint16_t t = entire_surface ? 0 : surface_handle->dirty.t;
-    uint16_t r = entire_surface ? (surface_handle->base.panel_width - 1) : surface_handle->dirty.r;
-    uint16_t b = entire_surface ? (surface_handle->base.panel_height - 1) : surface_handle->dirty.b;
+    // Keep the target's comms open for the whole rectangle, so pixel data can be streamed in the background
+    if (!qp_comms_start(target)) {
+        qp_dprintf("rgb565_target_pixdata_transfer: fail (could not start target comms)\n");
+        return false;
+    }
 
     // Set the target drawing area
-    bool ok = qp_viewport((painter_device_t)target_driver, x + l, y + t, x + r, y + b);
+    bool ok = target_driver->driver_vtable->viewport(target, x + l, y + t, x + r, y + b);
     if (!ok) {
         qp_dprintf("rgb565_target_pixdata_transfer: fail (could not set target viewport)\n");
+        qp_comms_stop(target);
         return false;
     }
 
@@ -96,12 +100,15 @@ static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, pai
 
             // If we've accumulated enough data, send it
             if (pixel_counter == total_pixel_count) {
-                ok = qp_pixdata((painter_device_t)target_driver, qp_internal_global_pixdata_buffer, pixel_counter);
+                ok = target_driver->driver_vtable->pixdata(target, qp_internal_global_pixdata_buffer, pixel_counter);
                 if (!ok) {
                     qp_dprintf("rgb565_target_pixdata_transfer: fail (could not stream pixdata to target)\n");
+                    qp_comms_stop(target);
                     return false;
                 }
-                // Reset the counter
+                // Carry on in the other buffer, if double-buffering, and reset the counter
+                qp_internal_swap_pixdata_buffer();
+                target_buffer = (uint16_t *)qp_internal_global_pixdata_buffer;
                 pixel_counter = 0;
             }
         }
@@ -109,9 +116,30 @@ static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, pai
 
     // If there's any leftover data, send it
     if (pixel_counter > 0) {
-        ok = qp_pixdata((painter_device_t)target_driver, qp_internal_global_pixdata_buffer, pixel_counter);
+        ok = target_driver->driver_vtable->pixdata(target, qp_internal_global_pixdata_buffer, pixel_counter);
         if (!ok) {
             qp_dprintf("rgb565_target_pixdata_transfer: fail (could not stream pixdata to target)\n");
+            qp_comms_stop(target);
+            return false;
+        }
+        qp_internal_swap_pixdata_buffer();
+    }
+
+    qp_comms_stop(target);
+    return true;
+}
+
+static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
+    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
+
+    if (entire_surface) {
+        return rgb565_target_pixdata_transfer_rect(surface_driver, target_driver, x, y, 0, 0, surface_handle->base.panel_width - 1, surface_handle->base.panel_height - 1);
+    }
+
+    // Each dirty rectangle gets its own viewport on the target
+    for (uint8_t i = 0; i < surface_handle->dirty.rect_count; ++i) {
+        const surface_dirty_rect_t *rect = &surface_handle->dirty.rects[i];
+        if (!rgb565_target_pixdata_transfer_rect(surface_driver, target_driver, x, y, rect->l, rect->t, rect->r, rect->b)) {
             return false;
         }
     }
@@ -93,6 +93,23 @@ spi_status_t spi_read(void);
  */
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length);
 
+typedef void (*spi_transmit_callback_t)(void *cb_arg);
+
+/**
+ * \brief Begin sending multiple bytes to the selected SPI device, returning before the transfer has completed.
+ *
+ * The data must remain valid, and no other SPI function may be called, until the callback has been invoked. The
+ * callback may be invoked from an interrupt context.
+ *
+ * \param data A pointer to the data to write from.
+ * \param length The number of bytes to write. Take care not to overrun the length of `data`.
+ * \param callback The function to invoke once the transfer has completed.
+ * \param cb_arg The argument supplied to `callback`.
+ *
+ * \return `SPI_STATUS_SUCCESS` if the transfer was started, otherwise an error status -- `callback` is not invoked.
+ */
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length, spi_transmit_callback_t callback, void *cb_arg);
+
 /**
  * \brief Receive multiple bytes from the selected SPI device.
  *
@@ -32,3 +32,8 @@
 #ifndef WEAR_LEVELING_LOGICAL_SIZE
 #    define WEAR_LEVELING_LOGICAL_SIZE ((WEAR_LEVELING_BACKING_SIZE) / 2)
 #endif // WEAR_LEVELING_LOGICAL_SIZE
+
+// With banked consolidation, erase one sector per step
+#if defined(WEAR_LEVELING_BANKED) && !defined(WEAR_LEVELING_BANK_ERASE_SIZE)
+#    define WEAR_LEVELING_BANK_ERASE_SIZE (EXTERNAL_FLASH_SECTOR_SIZE)
+#endif // WEAR_LEVELING_BANK_ERASE_SIZE
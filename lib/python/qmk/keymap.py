@@ -32,6 +32,7 @@ __INCLUDES__
 
 __KEYMAP_GOES_HERE__
 __ENCODER_MAP_GOES_HERE__
+__LEADER_TRIE_GOES_HERE__
 __MACRO_OUTPUT_GOES_HERE__
 
 #ifdef OTHER_KEYMAP_C
@@ -66,6 +67,34 @@ def _generate_encodermap_table(keymap_json):
     return lines
 
 
+def _generate_leader_trie(keymap_json):
+    """Compiles the leader sequences into a trie, laid out breadth-first so the children of each node are contiguous.
+    """
+    root = {'keycode': 'KC_NO', 'action': 'KC_NO', 'children': {}}
+    for leader_sequence in keymap_json['leader_sequences']:
+        node = root
+        for keycode in leader_sequence['sequence']:
+            keycode = _strip_any(keycode)
+            node = node['children'].setdefault(keycode, {'keycode': keycode, 'action': 'KC_NO', 'children': {}})
+        node['action'] = _strip_any(leader_sequence['keycode'])
+
+    # Nodes are appended while iterating, visiting each level of the trie in turn
+    nodes = [root]
+    for node in nodes:
+        node['first_child'] = len(nodes) if node['children'] else 0
+        nodes.extend(node['children'].values())
+
+    lines = [
+        '#if defined(LEADER_ENABLE)',
+        '#    define LEADER_TRIE_DEFINED',
+        'const leader_trie_node_t PROGMEM leader_trie[] = {',
+    ]
+    for node_num, node in enumerate(nodes):
+        lines.append(f'    [{node_num}] = {{{node["keycode"]}, {node["action"]}, {node["first_child"]}, {len(node["children"])}}},')
+    lines.extend(['};', '#endif // defined(LEADER_ENABLE)'])
+    return lines
+
+
 def _generate_macros_function(keymap_json):
     macro_txt = [
         'bool process_record_user(uint16_t keycode, keyrecord_t *record) {',
@@ -269,6 +298,9 @@ def generate_c(keymap_json):
         layers
             An array of arrays describing the keymap. Each item in the inner array should be a string that is a valid QMK keycode.
 
+        leader_sequences
+            An array of objects, each with a `sequence` of keycodes and the `keycode` to tap when it is entered after the leader key.
+
         macros
             A sequence of strings containing macros to implement for this keyboard.
     """
@@ -286,6 +318,12 @@ def generate_c(keymap_json):
         encodermap = '\n'.join(encoder_txt)
     new_keymap = new_keymap.replace('__ENCODER_MAP_GOES_HERE__', encodermap)
 
+    leader_trie = ''
+    if 'leader_sequences' in keymap_json and keymap_json['leader_sequences'] is not None:
+        leader_txt = _generate_leader_trie(keymap_json)
+        leader_trie = '\n'.join(leader_txt)
+    new_keymap = new_keymap.replace('__LEADER_TRIE_GOES_HERE__', leader_trie)
+
     macros = ''
     if 'macros' in keymap_json and keymap_json['macros'] is not None:
         macro_txt = _generate_macros_function(keymap_json)
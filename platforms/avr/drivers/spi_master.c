@@ -171,6 +171,17 @@ spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
     return SPI_STATUS_SUCCESS;
 }
 
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length, spi_transmit_callback_t callback, void *cb_arg) {
+    // No DMA available, so the transfer is completed before returning
+    spi_status_t status = spi_transmit(data, length);
+    if (status < 0) {
+        return status;
+    }
+
+    callback(cb_arg);
+    return SPI_STATUS_SUCCESS;
+}
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
     spi_status_t status;
 
@@ -131,6 +131,35 @@ inline uint32_t timer_read32(void) {
 #else
 #    define TIMER_INTERRUPT_VECTOR TIMER0_COMP_vect
 #endif
+#if defined(__AVR_ATmega32A__)
+#    define TIMER_INTERRUPT_PENDING (TIFR & _BV(OCF0))
+#elif defined(__AVR_ATtiny85__)
+#    define TIMER_INTERRUPT_PENDING (TIFR & _BV(OCF0A))
+#else
+#    define TIMER_INTERRUPT_PENDING (TIFR0 & _BV(OCF0A))
+#endif
 ISR(TIMER_INTERRUPT_VECTOR, ISR_NOBLOCK) {
     timer_count++;
 }
+
+#ifdef PROFILING_ENABLE
+/** \brief profiling timestamp
+ *
+ * Counts timer0 ticks, TIMER_RAW_FREQ per second.
+ */
+uint32_t profiling_timestamp(void) {
+    uint32_t t;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        uint8_t raw = TIMER_RAW;
+        t           = timer_count;
+        // The counter may have wrapped since interrupts were disabled, before timer_count caught up
+        if (TIMER_INTERRUPT_PENDING && raw < TIMER_RAW_TOP) {
+            t++;
+        }
+        t = t * (TIMER_RAW_TOP + 1) + raw;
+    }
+
+    return t;
+}
+#endif
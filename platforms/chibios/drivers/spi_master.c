@@ -67,6 +67,18 @@ static bool  current_cs_active_low = true;
 
 static SPIConfig spiConfig;
 
+static spi_transmit_callback_t async_callback = NULL;
+static void *                  async_cb_arg   = NULL;
+
+// Invoked from the SPI interrupt at the end of every operation (end_cb, or data_cb on SPI v2), only asynchronous transmits have a callback registered
+static void spi_end_callback(SPIDriver *spip) {
+    spi_transmit_callback_t callback = async_callback;
+    if (callback != NULL) {
+        async_callback = NULL;
+        callback(async_cb_arg);
+    }
+}
+
 static inline void spi_select(void) {
     spiSelect(&SPI_DRIVER);
 
@@ -420,6 +432,12 @@ bool spi_start_extended(spi_start_config_t *start_config) {
 #    error "Unsupported SPI_SELECT_MODE"
 #endif
 
+#ifndef HAL_LLD_SELECT_SPI_V2
+    spiConfig.end_cb = spi_end_callback;
+#else
+    spiConfig.data_cb = spi_end_callback;
+#endif
+
     spiStart(&SPI_DRIVER, &spiConfig);
     spi_select();
 
@@ -455,6 +473,13 @@ spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
     return SPI_STATUS_SUCCESS;
 }
 
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length, spi_transmit_callback_t callback, void *cb_arg) {
+    async_callback = callback;
+    async_cb_arg   = cb_arg;
+    spiStartSend(&SPI_DRIVER, length, data);
+    return SPI_STATUS_SUCCESS;
+}
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
     spiReceive(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
@@ -134,6 +134,36 @@ bool backing_store_erase(void) {
     return ret;
 }
 
+bool backing_store_erase_range(uint32_t address, size_t length) {
+    bool          ret = true;
+    flash_error_t status;
+    for (int i = 0; i < sector_count; ++i) {
+        // Sectors may differ in size, erase those within the range
+        const uint32_t sector_start = flashGetSectorOffset(flash, first_sector + i) - base_offset;
+        const uint32_t sector_end   = sector_start + flashGetSectorSize(flash, first_sector + i);
+        if (sector_end <= address || sector_start >= address + length) {
+            continue;
+        }
+
+        // Refuse to erase anything outside of the range, such as the other bank sharing a sector
+        if (sector_start < address || sector_end > address + length) {
+            bs_dprintf("Erase range 0x%04X+%d is not sector aligned\n", (int)address, (int)length);
+            return false;
+        }
+
+        status = flashStartEraseSector(flash, first_sector + i);
+        if (status != FLASH_NO_ERROR && status != FLASH_BUSY_ERASING) {
+            ret = false;
+        }
+
+        status = flashWaitErase(flash);
+        if (status != FLASH_NO_ERROR && status != FLASH_BUSY_ERASING) {
+            ret = false;
+        }
+    }
+    return ret;
+}
+
 bool backing_store_write(uint32_t address, backing_store_int_t value) {
     uint32_t offset = (base_offset + address);
     bs_dprintf("Write ");
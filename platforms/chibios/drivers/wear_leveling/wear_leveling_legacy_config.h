@@ -65,3 +65,8 @@
 #ifndef WEAR_LEVELING_LOGICAL_SIZE
 #    define WEAR_LEVELING_LOGICAL_SIZE 1024
 #endif
+
+// With banked consolidation, erase one page per step
+#if defined(WEAR_LEVELING_BANKED) && !defined(WEAR_LEVELING_BANK_ERASE_SIZE)
+#    define WEAR_LEVELING_BANK_ERASE_SIZE (WEAR_LEVELING_LEGACY_EMULATION_PAGE_SIZE)
+#endif // WEAR_LEVELING_BANK_ERASE_SIZE
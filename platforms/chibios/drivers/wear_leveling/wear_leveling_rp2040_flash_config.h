@@ -30,3 +30,8 @@
 #ifndef WEAR_LEVELING_RP2040_FLASH_BASE
 #    define WEAR_LEVELING_RP2040_FLASH_BASE ((WEAR_LEVELING_RP2040_FLASH_SIZE) - (WEAR_LEVELING_BACKING_SIZE))
 #endif
+
+// With banked consolidation, erase one sector per step
+#if defined(WEAR_LEVELING_BANKED) && !defined(WEAR_LEVELING_BANK_ERASE_SIZE)
+#    define WEAR_LEVELING_BANK_ERASE_SIZE (FLASH_SECTOR_SIZE)
+#endif // WEAR_LEVELING_BANK_ERASE_SIZE
@@ -79,16 +79,13 @@ void sendByte(uint8_t byte) {
 ws2812_led_t ws2812_leds[WS2812_LED_COUNT];
 
 void ws2812_init(void) {
+    ws2812_mark_all_dirty();
+
     palSetLineMode(WS2812_DI_PIN, WS2812_OUTPUT_MODE);
 }
 
 void ws2812_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
-    ws2812_leds[index].r = red;
-    ws2812_leds[index].g = green;
-    ws2812_leds[index].b = blue;
-#if defined(WS2812_RGBW)
-    ws2812_rgb_to_rgbw(&ws2812_leds[index]);
-#endif
+    ws2812_update_led(ws2812_leds, index, red, green, blue);
 }
 
 void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
@@ -98,10 +95,15 @@ void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 }
 
 void ws2812_flush(void) {
+    uint16_t count = ws2812_take_dirty_count();
+    if (count == 0) {
+        return;
+    }
+
     // this code is very time dependent, so we need to disable interrupts
     chSysLock();
 
-    for (int i = 0; i < WS2812_LED_COUNT; i++) {
+    for (int i = 0; i < count; i++) {
         // WS2812 protocol dictates grb order
 #if (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_GRB)
         sendByte(ws2812_leds[i].g);
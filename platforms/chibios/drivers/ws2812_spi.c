@@ -2,6 +2,7 @@
 #include "gpio.h"
 #include "util.h"
 #include "chibios_config.h"
+#include <string.h>
 
 /* Adapted from https://github.com/gamazeps/ws2812b-chibios-SPIDMA/ */
 
@@ -167,6 +168,8 @@ static void set_led_color_rgb(ws2812_led_t color, int pos) {
 ws2812_led_t ws2812_leds[WS2812_LED_COUNT];
 
 void ws2812_init(void) {
+    ws2812_mark_all_dirty();
+
     palSetLineMode(WS2812_DI_PIN, WS2812_MOSI_OUTPUT_MODE);
 
 #ifdef WS2812_SPI_SCK_PIN
@@ -225,12 +228,7 @@ void ws2812_init(void) {
 }
 
 void ws2812_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
-    ws2812_leds[index].r = red;
-    ws2812_leds[index].g = green;
-    ws2812_leds[index].b = blue;
-#if defined(WS2812_RGBW)
-    ws2812_rgb_to_rgbw(&ws2812_leds[index]);
-#endif
+    ws2812_update_led(ws2812_leds, index, red, green, blue);
 }
 
 void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
@@ -240,17 +238,27 @@ void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 }
 
 void ws2812_flush(void) {
-    for (int i = 0; i < WS2812_LED_COUNT; i++) {
+    uint16_t count = ws2812_take_dirty_count();
+    if (count == 0) {
+        return;
+    }
+
+    // LEDs past the last changed one keep the data they were last sent with.
+    for (int i = 0; i < count; i++) {
         set_led_color_rgb(ws2812_leds[i], i);
     }
 
     // Send async - each led takes ~0.03ms, 50 leds ~1.5ms, animations flushing faster than send will cause issues.
     // Instead spiSend can be used to send synchronously (or the thread logic can be added back).
 #ifndef WS2812_SPI_USE_CIRCULAR_BUFFER
+    // Only the LEDs up to the last changed one are sent, moving the reset right after them. The next flush encodes
+    // every LED it sends again, so the data overwritten by the reset is never needed.
+    const size_t length = PREAMBLE_SIZE + BYTES_FOR_LED * count + RESET_SIZE;
+    memset(&txbuf[PREAMBLE_SIZE + BYTES_FOR_LED * count], 0, RESET_SIZE);
 #    ifdef WS2812_SPI_SYNC
-    spiSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
+    spiSend(&WS2812_SPI_DRIVER, length, txbuf);
 #    else
-    spiStartSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
+    spiStartSend(&WS2812_SPI_DRIVER, length, txbuf);
 #    endif
 #endif
 }
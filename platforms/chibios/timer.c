@@ -118,3 +118,17 @@ uint32_t timer_read32(void) {
 
     return (uint32_t)TIME_I2MS(ticks) + ms_offset_copy;
 }
+
+#ifdef PROFILING_ENABLE
+// Cycles where the port provides a realtime counter (DWT on Cortex-M3 and up), system ticks otherwise.
+uint32_t profiling_timestamp(void) {
+#    if PORT_SUPPORTS_RT == TRUE
+    return (uint32_t)chSysGetRealtimeCounterX();
+#    else
+    syssts_t sts   = chSysGetStatusAndLockX();
+    uint32_t ticks = get_system_time_ticks();
+    chSysRestoreStatusX(sts);
+    return ticks;
+#    endif
+}
+#endif
@@ -16,6 +16,9 @@
 
 #include "timer.h"
 #include <stdatomic.h>
+#ifdef PROFILING_ENABLE
+#    include <time.h>
+#endif
 
 static atomic_uint_least32_t current_time      = 0;
 static atomic_uint_least32_t async_tick_amount = 0;
@@ -73,3 +76,12 @@ void advance_time(uint32_t ms) {
 void wait_ms(uint32_t ms) {
     advance_time(ms);
 }
+
+#ifdef PROFILING_ENABLE
+// Host nanoseconds, independent of the simulated time above.
+uint32_t profiling_timestamp(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+}
+#endif
@@ -25,6 +25,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "led.h"
 #include "action_layer.h"
 #include "action_tapping.h"
+#include "profiling.h"
 #include "action_util.h"
 #include "action.h"
 #include "wait.h"
@@ -285,7 +286,10 @@ void process_record(keyrecord_t *record) {
     flow_tap_update_last_event(record);
 #endif // FLOW_TAP_TERM
 
-    if (!process_record_quantum(record)) {
+    PROFILE_ZONE_BEGIN(PROFILE_ZONE_PROCESS_RECORD_QUANTUM);
+    const bool process_record_continue = process_record_quantum(record);
+    PROFILE_ZONE_END(PROFILE_ZONE_PROCESS_RECORD_QUANTUM);
+    if (!process_record_continue) {
 #ifndef NO_ACTION_ONESHOT
         if (is_oneshot_layer_active() && record->event.pressed && keymap_config.oneshot_enable) {
             clear_oneshot_layer_state(ONESHOT_OTHER_KEY_PRESSED);
@@ -1,5 +1,6 @@
 #include <limits.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "keyboard.h"
 #include "action.h"
@@ -335,6 +336,46 @@ action_t store_or_get_action(bool pressed, keypos_t key) {
 #endif
 }
 
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_TRANSPARENCY_MASK)
+/** \brief layer transparency mask
+ *
+ * Bit n is set when the key is not transparent on layer n. Each key's mask is
+ * filled in on its first lookup, tracked by layer_transparency_mask_valid.
+ */
+static layer_state_t layer_transparency_mask[MATRIX_ROWS][MATRIX_COLS];
+static uint8_t       layer_transparency_mask_valid[((MATRIX_ROWS * MATRIX_COLS) + (CHAR_BIT)-1) / (CHAR_BIT)] = {0};
+
+/** \brief Invalidate layer transparency mask
+ *
+ * Must be called whenever the keymap changes
+ */
+void layer_transparency_mask_invalidate(void) {
+    memset(layer_transparency_mask_valid, 0, sizeof(layer_transparency_mask_valid));
+}
+
+/** \brief Get layer transparency mask
+ *
+ * Gets the non-transparent layers of a matrix key, building its mask if needed
+ */
+static layer_state_t layer_transparency_mask_get(keypos_t key) {
+    const uint16_t entry_number = (uint16_t)(key.row * MATRIX_COLS) + key.col;
+    const uint16_t storage_idx  = entry_number / (CHAR_BIT);
+    const uint8_t  storage_bit  = entry_number % (CHAR_BIT);
+
+    if (!(layer_transparency_mask_valid[storage_idx] & (1U << storage_bit))) {
+        layer_state_t mask = 0;
+        for (uint8_t layer = 0; layer < MAX_LAYER; layer++) {
+            if (action_for_key(layer, key).code != ACTION_TRANSPARENT) {
+                mask |= (layer_state_t)1 << layer;
+            }
+        }
+        layer_transparency_mask[key.row][key.col] = mask;
+        layer_transparency_mask_valid[storage_idx] |= (1U << storage_bit);
+    }
+    return layer_transparency_mask[key.row][key.col];
+}
+#endif
+
 /** \brief Layer switch get layer
  *
  * Gets the layer based on key info
@@ -345,6 +386,13 @@ uint8_t layer_switch_get_layer(keypos_t key) {
     action.code = ACTION_TRANSPARENT;
 
     layer_state_t layers = layer_state | default_layer_state;
+#    ifdef LAYER_TRANSPARENCY_MASK
+    if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+        layers &= layer_transparency_mask_get(key);
+        /* fall back to layer 0 */
+        return layers ? get_highest_layer(layers) : 0;
+    }
+#    endif
     /* check top layer first */
     for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
         if (layers & ((layer_state_t)1 << i)) {
@@ -169,5 +169,10 @@ action_t store_or_get_action(bool pressed, keypos_t key);
 /* return the topmost non-transparent layer currently associated with key */
 uint8_t layer_switch_get_layer(keypos_t key);
 
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_TRANSPARENCY_MASK)
+/* rebuild the per key non-transparent layer masks on next lookup, call after changing the keymap */
+void layer_transparency_mask_invalidate(void);
+#endif
+
 /* return action depending on current layer status */
 action_t layer_switch_get_action(keypos_t key);
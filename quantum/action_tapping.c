@@ -1,5 +1,6 @@
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include "action.h"
 #include "action_layer.h"
@@ -110,11 +111,39 @@ static bool     flow_tap_expired      = true;
 static bool flow_tap_key_if_within_term(keyrecord_t *record, uint16_t prev_time);
 #    endif // defined(FLOW_TAP_TERM)
 
+#    if WAITING_BUFFER_SIZE > 255
+#        error "WAITING_BUFFER_SIZE must fit the uint8_t buffer indices"
+#    endif
+
 static keyrecord_t tapping_key                         = {};
 static keyrecord_t waiting_buffer[WAITING_BUFFER_SIZE] = {};
 static uint8_t     waiting_buffer_head                 = 0;
 static uint8_t     waiting_buffer_tail                 = 0;
 
+#    ifdef WAITING_BUFFER_SKIP_RETRIES
+/* Everything the outcome of process_tapping() on a buffered record depends on,
+ * besides the record itself and the tap-hold callbacks, which have to be pure.
+ * Buffered records carry their own timestamps, so the passing of time alone
+ * cannot settle them.
+ */
+typedef struct {
+    keyrecord_t   tapping_key;
+    layer_state_t layers;
+    uint8_t       mods;
+    uint8_t       oneshot_mods;
+    uint8_t       head;
+    uint8_t       tail;
+} waiting_buffer_state_t;
+
+// State in which the tail of waiting_buffer last failed to settle.
+static waiting_buffer_state_t waiting_buffer_unsettled       = {};
+static bool                   waiting_buffer_unsettled_valid = false;
+#    endif // WAITING_BUFFER_SKIP_RETRIES
+
+static inline uint8_t waiting_buffer_next(uint8_t i) {
+    return ++i == WAITING_BUFFER_SIZE ? 0 : i;
+}
+
 static bool process_tapping(keyrecord_t *record);
 static bool waiting_buffer_enq(keyrecord_t record);
 static void waiting_buffer_clear(void);
@@ -124,6 +153,54 @@ static void waiting_buffer_scan_tap(void);
 static void debug_tapping_key(void);
 static void debug_waiting_buffer(void);
 
+#    ifdef WAITING_BUFFER_SKIP_RETRIES
+static void waiting_buffer_get_state(waiting_buffer_state_t *state) {
+    memset(state, 0, sizeof(*state)); // padding takes part in the comparison
+    state->tapping_key  = tapping_key;
+    state->layers       = layer_state | default_layer_state;
+    state->mods         = get_mods();
+    state->oneshot_mods = get_oneshot_mods();
+    state->head         = waiting_buffer_head;
+    state->tail         = waiting_buffer_tail;
+}
+
+static bool waiting_buffer_state_unchanged(const waiting_buffer_state_t *state) {
+    waiting_buffer_state_t current;
+    waiting_buffer_get_state(&current);
+    return memcmp(&current, state, sizeof(current)) == 0;
+}
+#    endif // WAITING_BUFFER_SKIP_RETRIES
+
+/** \brief Processes and pops buffered events until one does not settle. */
+static void waiting_buffer_process_settled(bool is_event) {
+#    ifdef WAITING_BUFFER_SKIP_RETRIES
+    // Ticks skip the retry while the tail is still blocked on the same state
+    if (!is_event && waiting_buffer_unsettled_valid && waiting_buffer_state_unchanged(&waiting_buffer_unsettled)) {
+        return;
+    }
+    waiting_buffer_unsettled_valid = false;
+#    endif // WAITING_BUFFER_SKIP_RETRIES
+    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = waiting_buffer_next(waiting_buffer_tail)) {
+#    ifdef WAITING_BUFFER_SKIP_RETRIES
+        waiting_buffer_state_t state;
+        waiting_buffer_get_state(&state);
+#    endif // WAITING_BUFFER_SKIP_RETRIES
+        if (!process_tapping(&waiting_buffer[waiting_buffer_tail])) {
+#    ifdef WAITING_BUFFER_SKIP_RETRIES
+            // Only a failure without side effects is sure to fail again.
+            if (waiting_buffer_state_unchanged(&state)) {
+                waiting_buffer_unsettled       = state;
+                waiting_buffer_unsettled_valid = true;
+            }
+#    endif // WAITING_BUFFER_SKIP_RETRIES
+            break;
+        }
+        ac_dprintf("processed: waiting_buffer[%u] =", waiting_buffer_tail);
+        debug_record(waiting_buffer[waiting_buffer_tail]);
+        ac_dprintf("\n\n");
+    }
+}
+
 /** \brief Action Tapping Process
  *
  * FIXME: Needs doc
@@ -149,21 +226,16 @@ void action_tapping_process(keyrecord_t record) {
     if (IS_EVENT(record.event) && waiting_buffer_head != waiting_buffer_tail) {
         ac_dprintf("---- action_exec: process waiting_buffer -----\n");
     }
-    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
-        if (process_tapping(&waiting_buffer[waiting_buffer_tail])) {
-            ac_dprintf("processed: waiting_buffer[%u] =", waiting_buffer_tail);
-            debug_record(waiting_buffer[waiting_buffer_tail]);
-            ac_dprintf("\n\n");
-        } else {
-            break;
-        }
-    }
+    waiting_buffer_process_settled(IS_EVENT(record.event));
     if (IS_EVENT(record.event)) {
         ac_dprintf("\n");
     } else {
 #    ifdef FLOW_TAP_TERM
         if (!flow_tap_expired && TIMER_DIFF_16(record.event.time, flow_tap_prev_time) >= INT16_MAX / 2) {
             flow_tap_expired = true;
+#        ifdef WAITING_BUFFER_SKIP_RETRIES
+            waiting_buffer_unsettled_valid = false;
+#        endif // WAITING_BUFFER_SKIP_RETRIES
         }
 #    endif // FLOW_TAP_TERM
     }
@@ -293,7 +365,7 @@ bool process_tapping(keyrecord_t *keyp) {
                     // Now that tapping_key has settled as tapped, check whether
                     // Flow Tap applies to following yet-unsettled keys.
                     uint16_t prev_time = tapping_key.event.time;
-                    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+                    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = waiting_buffer_next(waiting_buffer_tail)) {
                         keyrecord_t *record = &waiting_buffer[waiting_buffer_tail];
                         if (!record->event.pressed) {
                             break;
@@ -353,7 +425,7 @@ bool process_tapping(keyrecord_t *keyp) {
                     uint8_t first_tap = waiting_buffer_find_chordal_hold_tap();
                     ac_dprintf("first_tap = %u\n", first_tap);
                     if (first_tap < WAITING_BUFFER_SIZE) {
-                        for (; waiting_buffer_tail != first_tap; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+                        for (; waiting_buffer_tail != first_tap; waiting_buffer_tail = waiting_buffer_next(waiting_buffer_tail)) {
                             ac_dprintf("Processing [%u]\n", waiting_buffer_tail);
                             process_record(&waiting_buffer[waiting_buffer_tail]);
                         }
@@ -453,7 +525,7 @@ bool process_tapping(keyrecord_t *keyp) {
                             if (waiting_buffer_tail != waiting_buffer_head && is_tap_record(&waiting_buffer[waiting_buffer_tail])) {
                                 tapping_key = waiting_buffer[waiting_buffer_tail];
                                 // Pop tail from the queue.
-                                waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE;
+                                waiting_buffer_tail = waiting_buffer_next(waiting_buffer_tail);
                                 debug_waiting_buffer();
                             } else
 #    endif // CHORDAL_HOLD
@@ -629,13 +701,13 @@ bool waiting_buffer_enq(keyrecord_t record) {
         return true;
     }
 
-    if ((waiting_buffer_head + 1) % WAITING_BUFFER_SIZE == waiting_buffer_tail) {
+    if (waiting_buffer_next(waiting_buffer_head) == waiting_buffer_tail) {
         ac_dprintf("waiting_buffer_enq: Over flow.\n");
         return false;
     }
 
     waiting_buffer[waiting_buffer_head] = record;
-    waiting_buffer_head                 = (waiting_buffer_head + 1) % WAITING_BUFFER_SIZE;
+    waiting_buffer_head                 = waiting_buffer_next(waiting_buffer_head);
 
     ac_dprintf("waiting_buffer_enq: ");
     debug_waiting_buffer();
@@ -649,6 +721,9 @@ bool waiting_buffer_enq(keyrecord_t record) {
 void waiting_buffer_clear(void) {
     waiting_buffer_head = 0;
     waiting_buffer_tail = 0;
+#    ifdef WAITING_BUFFER_SKIP_RETRIES
+    waiting_buffer_unsettled_valid = false;
+#    endif // WAITING_BUFFER_SKIP_RETRIES
 }
 
 /** \brief Waiting buffer typed
@@ -656,7 +731,7 @@ void waiting_buffer_clear(void) {
  * FIXME: Needs docs
  */
 bool waiting_buffer_typed(keyevent_t event) {
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = waiting_buffer_next(i)) {
         if (KEYEQ(event.key, waiting_buffer[i].event.key) && event.pressed != waiting_buffer[i].event.pressed) {
             return true;
         }
@@ -669,7 +744,7 @@ bool waiting_buffer_typed(keyevent_t event) {
  * FIXME: Needs docs
  */
 __attribute__((unused)) bool waiting_buffer_has_anykey_pressed(void) {
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = waiting_buffer_next(i)) {
         if (waiting_buffer[i].event.pressed) return true;
     }
     return false;
@@ -690,7 +765,7 @@ void waiting_buffer_scan_tap(void) {
 #    if (defined(AUTO_SHIFT_ENABLE) && defined(RETRO_SHIFT))
     TAP_DEFINE_KEYCODE;
 #    endif
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = waiting_buffer_next(i)) {
         keyrecord_t *candidate = &waiting_buffer[i];
         // clang-format off
         if (IS_EVENT(candidate->event) && KEYEQ(candidate->event.key, tapping_key.event.key) && !candidate->event.pressed && (
@@ -774,7 +849,7 @@ static uint8_t waiting_buffer_find_chordal_hold_tap(void) {
     keyrecord_t *prev         = &tapping_key;
     uint16_t     prev_keycode = get_record_keycode(&tapping_key, false);
     uint8_t      first_tap    = WAITING_BUFFER_SIZE;
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = waiting_buffer_next(i)) {
         keyrecord_t *  cur         = &waiting_buffer[i];
         const uint16_t cur_keycode = get_record_keycode(cur, false);
         if (!cur->event.pressed || !is_mt_or_lt(prev_keycode)) {
@@ -797,7 +872,7 @@ static void waiting_buffer_chordal_hold_taps_until(keypos_t key) {
             registered_taps_add(record->event.key);
         }
         process_record(record);
-        waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE;
+        waiting_buffer_tail = waiting_buffer_next(waiting_buffer_tail);
 
         if (KEYEQ(key, record->event.key) && record->event.pressed) {
             break;
@@ -806,7 +881,7 @@ static void waiting_buffer_chordal_hold_taps_until(keypos_t key) {
 }
 
 static void waiting_buffer_process_regular(void) {
-    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = waiting_buffer_next(waiting_buffer_tail)) {
         if (is_tap_record(&waiting_buffer[waiting_buffer_tail])) {
             break; // Stop once a tap-hold key event is reached.
         }
@@ -921,7 +996,7 @@ static void debug_tapping_key(void) {
 /** \brief Logs waiting buffer if ACTION_DEBUG is enabled. */
 static void debug_waiting_buffer(void) {
     ac_dprintf("{");
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = waiting_buffer_next(i)) {
         ac_dprintf(" [%u]=", i);
         debug_record(waiting_buffer[i]);
     }
@@ -5,6 +5,8 @@
 /*
     This API allows for basic profiling information to be printed out over console.
 
+    For persistent per-zone statistics see profiling.h (`PROFILING_ENABLE = yes`).
+
     Usage example:
 
         #include "basic_profiling.h"
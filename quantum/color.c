@@ -19,82 +19,74 @@
 #include "progmem.h"
 #include "util.h"
 
-rgb_t hsv_to_rgb_impl(hsv_t hsv, bool use_cie) {
-    rgb_t    rgb;
-    uint8_t  region, remainder, p, q, t;
-    uint16_t h, s, v;
+enum { HSV_V, HSV_P, HSV_Q, HSV_T };
 
-    if (hsv.s == 0) {
-#ifdef USE_CIE1931_CURVE
-        if (use_cie) {
-            rgb.r = rgb.g = rgb.b = pgm_read_byte(&CIE1931_CURVE[hsv.v]);
-        } else {
-            rgb.r = hsv.v;
-            rgb.g = hsv.v;
-            rgb.b = hsv.v;
-        }
-#else
-        rgb.r = hsv.v;
-        rgb.g = hsv.v;
-        rgb.b = hsv.v;
-#endif
+// Which of v, p, q and t goes to r (bits 0-1), g (bits 2-3) and b (bits 4-5) per hue region
+#define HSV_REGION(r, g, b) ((r) | (g) << 2 | (b) << 4)
+
+// clang-format off
+static const uint8_t hsv_regions[7] = {
+    HSV_REGION(HSV_V, HSV_T, HSV_P),
+    HSV_REGION(HSV_Q, HSV_V, HSV_P),
+    HSV_REGION(HSV_P, HSV_V, HSV_T),
+    HSV_REGION(HSV_P, HSV_Q, HSV_V),
+    HSV_REGION(HSV_T, HSV_P, HSV_V),
+    HSV_REGION(HSV_V, HSV_P, HSV_Q),
+    // h = 255 wraps around to red
+    HSV_REGION(HSV_V, HSV_T, HSV_P),
+};
+// clang-format on
+
+static inline rgb_t hsv_to_rgb_kernel(uint8_t h, uint8_t s, uint8_t v) {
+    rgb_t rgb;
+
+    if (s == 0) {
+        rgb.r = v;
+        rgb.g = v;
+        rgb.b = v;
         return rgb;
     }
 
-    h = hsv.h;
-    s = hsv.s;
+    // h * 6 / 255 without the division, exact for h * 6 < 65535
+    uint16_t h6        = h * 6;
+    uint8_t  region    = (h6 + 1 + (h6 >> 8)) >> 8;
+    uint8_t  remainder = (h * 2 - region * 85) * 3;
+
+    uint8_t values[4];
+    values[HSV_V] = v;
+    values[HSV_P] = (v * (255 - s)) >> 8;
+    values[HSV_Q] = (v * (255 - ((s * remainder) >> 8))) >> 8;
+    values[HSV_T] = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
+
+    uint8_t select = hsv_regions[region];
+    rgb.r          = values[select & 0x03];
+    rgb.g          = values[(select >> 2) & 0x03];
+    rgb.b          = values[select >> 4];
+
+    return rgb;
+}
+
+rgb_t hsv_to_rgb_impl(hsv_t hsv, bool use_cie) {
 #ifdef USE_CIE1931_CURVE
     if (use_cie) {
-        v = pgm_read_byte(&CIE1931_CURVE[hsv.v]);
-    } else {
-        v = hsv.v;
+        hsv.v = pgm_read_byte(&CIE1931_CURVE[hsv.v]);
     }
-#else
-    v = hsv.v;
 #endif
+    return hsv_to_rgb_kernel(hsv.h, hsv.s, hsv.v);
+}
 
-    region    = h * 6 / 255;
-    remainder = (h * 2 - region * 85) * 3;
-
-    p = (v * (255 - s)) >> 8;
-    q = (v * (255 - ((s * remainder) >> 8))) >> 8;
-    t = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
-
-    switch (region) {
-        case 6:
-        case 0:
-            rgb.r = v;
-            rgb.g = t;
-            rgb.b = p;
-            break;
-        case 1:
-            rgb.r = q;
-            rgb.g = v;
-            rgb.b = p;
-            break;
-        case 2:
-            rgb.r = p;
-            rgb.g = v;
-            rgb.b = t;
-            break;
-        case 3:
-            rgb.r = p;
-            rgb.g = q;
-            rgb.b = v;
-            break;
-        case 4:
-            rgb.r = t;
-            rgb.g = p;
-            rgb.b = v;
-            break;
-        default:
-            rgb.r = v;
-            rgb.g = p;
-            rgb.b = q;
-            break;
+static void hsv_to_rgb_batch_impl(const hsv_t *hsv, rgb_t *rgb, uint8_t count, bool use_cie) {
+#ifdef USE_CIE1931_CURVE
+    if (use_cie) {
+        for (uint8_t i = 0; i < count; i++) {
+            rgb[i] = hsv_to_rgb_kernel(hsv[i].h, hsv[i].s, pgm_read_byte(&CIE1931_CURVE[hsv[i].v]));
+        }
+        return;
+    }
+#endif
+    for (uint8_t i = 0; i < count; i++) {
+        rgb[i] = hsv_to_rgb_kernel(hsv[i].h, hsv[i].s, hsv[i].v);
     }
-
-    return rgb;
 }
 
 rgb_t hsv_to_rgb(hsv_t hsv) {
@@ -108,3 +100,15 @@ rgb_t hsv_to_rgb(hsv_t hsv) {
 rgb_t hsv_to_rgb_nocie(hsv_t hsv) {
     return hsv_to_rgb_impl(hsv, false);
 }
+
+void hsv_to_rgb_batch(const hsv_t *hsv, rgb_t *rgb, uint8_t count) {
+#ifdef USE_CIE1931_CURVE
+    hsv_to_rgb_batch_impl(hsv, rgb, count, true);
+#else
+    hsv_to_rgb_batch_impl(hsv, rgb, count, false);
+#endif
+}
+
+void hsv_to_rgb_batch_nocie(const hsv_t *hsv, rgb_t *rgb, uint8_t count) {
+    hsv_to_rgb_batch_impl(hsv, rgb, count, false);
+}
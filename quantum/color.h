@@ -95,3 +95,10 @@ typedef hsv_t HSV;
 
 rgb_t hsv_to_rgb(hsv_t hsv);
 rgb_t hsv_to_rgb_nocie(hsv_t hsv);
+
+/**
+ * @brief Converts `count` colors from `hsv` into `rgb`, with the same results
+ * as calling hsv_to_rgb() on each of them.
+ */
+void hsv_to_rgb_batch(const hsv_t *hsv, rgb_t *rgb, uint8_t count);
+void hsv_to_rgb_batch_nocie(const hsv_t *hsv, rgb_t *rgb, uint8_t count);
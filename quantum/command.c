@@ -35,6 +35,14 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "usb_device_state.h"
 #include "version.h"
 
+#ifdef PROFILING_ENABLE
+#    include "profiling.h"
+#endif
+
+#if defined(WEAR_LEVELING_ENABLE) && defined(WEAR_LEVELING_STATS)
+#    include "wear_leveling_stats.h"
+#endif
+
 #ifdef BACKLIGHT_ENABLE
 #    include "backlight.h"
 #endif
@@ -157,6 +165,14 @@ static void command_common_help(void) {
 #ifdef SLEEP_LED_ENABLE
         STR(MAGIC_KEY_SLEEP_LED) ":	Sleep LED Test\n"
 #endif
+
+#ifdef PROFILING_ENABLE
+        STR(MAGIC_KEY_PROFILING) ":	Print and Reset Profiling Zones\n"
+#endif
+
+#if defined(WEAR_LEVELING_ENABLE) && defined(WEAR_LEVELING_STATS)
+        STR(MAGIC_KEY_WEAR_LEVELING) ":	Print Wear-leveling Statistics\n"
+#endif
     ); /* clang-format on */
 }
 
@@ -439,6 +455,23 @@ static bool command_common(uint8_t code) {
             print_status();
             break;
 
+#ifdef PROFILING_ENABLE
+
+        // print and reset profiling zones
+        case MAGIC_KC(MAGIC_KEY_PROFILING):
+            profiling_print();
+            profiling_reset();
+            break;
+#endif
+
+#if defined(WEAR_LEVELING_ENABLE) && defined(WEAR_LEVELING_STATS)
+
+        // print wear-leveling statistics
+        case MAGIC_KC(MAGIC_KEY_WEAR_LEVELING):
+            wear_leveling_print_stats();
+            break;
+#endif
+
 #ifdef NKRO_ENABLE
 
         // NKRO toggle
@@ -158,5 +158,13 @@ bool command_proc(uint8_t code);
 
 #endif
 
+#ifndef MAGIC_KEY_PROFILING
+#    define MAGIC_KEY_PROFILING P
+#endif
+
+#ifndef MAGIC_KEY_WEAR_LEVELING
+#    define MAGIC_KEY_WEAR_LEVELING W
+#endif
+
 #define XMAGIC_KC(key) KC_##key
 #define MAGIC_KC(key) XMAGIC_KC(key)
@@ -5,38 +5,122 @@
 #include <timer.h>
 #include <deferred_exec.h>
 
-#ifndef MAX_DEFERRED_EXECUTORS
-#    define MAX_DEFERRED_EXECUTORS 8
-#endif
-
 //------------------------------------
 // Helpers
 //
+// Every table doubles as a binary min-heap ordered by trigger time. Position p of the heap holds the slot
+// table[p].heap_slot, and slot s sits at position table[s].heap_pos. Positions [0, heap_count) are the pending
+// executors, [heap_count, heap_count + held_count) the ones that already ran in the current tick and are due
+// again, and the remaining positions are the free slots. heap_count and held_count live in table[0].
+//
+// Both indices are stored XORed with their own index, so a zero-initialised table reads as the identity
+// permutation with every slot free.
+//
+// Tokens encode their slot, token = slot + 1 + generation * table_count, which makes looking them up O(1).
 
-static deferred_token current_token = 0;
+#define DEFERRED_TOKEN_MAX ((deferred_token)~0)
 
-static inline bool token_can_be_used(deferred_executor_t *table, size_t table_count, deferred_token token) {
-    if (token == INVALID_DEFERRED_TOKEN) {
-        return false;
-    }
-    for (int i = 0; i < table_count; ++i) {
-        if (table[i].token == token) {
-            return false;
+static deferred_token current_generation = 0;
+
+static inline size_t usable_count(size_t table_count) {
+    return table_count < DEFERRED_TOKEN_MAX ? table_count : DEFERRED_TOKEN_MAX;
+}
+
+static inline size_t slot_at(deferred_executor_t *table, size_t pos) {
+    return table[pos].heap_slot ^ pos;
+}
+
+static inline size_t position_of(deferred_executor_t *table, size_t slot) {
+    return table[slot].heap_pos ^ slot;
+}
+
+static inline void place(deferred_executor_t *table, size_t pos, size_t slot) {
+    table[pos].heap_slot = slot ^ pos;
+    table[slot].heap_pos = pos ^ slot;
+}
+
+static inline void swap_positions(deferred_executor_t *table, size_t a, size_t b) {
+    size_t slot_a = slot_at(table, a);
+    place(table, a, slot_at(table, b));
+    place(table, b, slot_a);
+}
+
+static inline bool triggers_before(deferred_executor_t *table, size_t a, size_t b) {
+    return ((int32_t)TIMER_DIFF_32(table[slot_at(table, a)].trigger_time, table[slot_at(table, b)].trigger_time)) < 0;
+}
+
+static void sift_up(deferred_executor_t *table, size_t pos) {
+    while (pos > 0) {
+        size_t parent = (pos - 1) / 2;
+        if (!triggers_before(table, pos, parent)) {
+            break;
         }
+        swap_positions(table, pos, parent);
+        pos = parent;
     }
-    return true;
 }
 
-static inline deferred_token allocate_token(deferred_executor_t *table, size_t table_count) {
-    deferred_token first = ++current_token;
-    while (!token_can_be_used(table, table_count, current_token)) {
-        ++current_token;
-        if (current_token == first) {
-            // If we've looped back around to the first, everything is already allocated (yikes!). Need to exit with a failure.
-            return INVALID_DEFERRED_TOKEN;
+static void sift_down(deferred_executor_t *table, size_t pos) {
+    size_t count = table[0].heap_count;
+    while (true) {
+        size_t first = pos;
+        size_t left  = pos * 2 + 1;
+        size_t right = left + 1;
+        if (left < count && triggers_before(table, left, first)) {
+            first = left;
         }
+        if (right < count && triggers_before(table, right, first)) {
+            first = right;
+        }
+        if (first == pos) {
+            break;
+        }
+        swap_positions(table, pos, first);
+        pos = first;
+    }
+}
+
+static void heap_update(deferred_executor_t *table, size_t pos) {
+    if (pos > 0 && triggers_before(table, pos, (pos - 1) / 2)) {
+        sift_up(table, pos);
+    } else {
+        sift_down(table, pos);
+    }
+}
+
+// Takes the executor at `pos` out of the heap, leaving it at the position right before the held executors
+static size_t heap_remove(deferred_executor_t *table, size_t pos) {
+    size_t last = --table[0].heap_count;
+    if (pos != last) {
+        swap_positions(table, pos, last);
+        heap_update(table, pos);
+    }
+    return last;
+}
+
+static deferred_executor_t *find_entry(deferred_executor_t *table, size_t table_count, deferred_token token) {
+    size_t count = usable_count(table_count);
+    if (token == INVALID_DEFERRED_TOKEN || count == 0) {
+        return NULL;
+    }
+    deferred_executor_t *entry = &table[(token - 1) % count];
+    return entry->token == token ? entry : NULL;
+}
+
+static void release_entry(deferred_executor_t *table, deferred_executor_t *entry) {
+    size_t pos = position_of(table, entry - table);
+    if (pos < table[0].heap_count) {
+        pos = heap_remove(table, pos);
+        table[0].held_count++;
     }
-    return current_token;
+
+    // Move it from the held executors to the front of the free slots
+    swap_positions(table, pos, table[0].heap_count + --table[0].held_count);
+
+    entry->token        = INVALID_DEFERRED_TOKEN;
+    entry->trigger_time = 0;
+    entry->callback     = NULL;
+    entry->cb_arg       = NULL;
 }
 
 //------------------------------------
@@ -44,32 +128,35 @@ static inline deferred_token allocate_token(deferred_executor_t *table, size_t t
 //
 
 deferred_token defer_exec_advanced(deferred_executor_t *table, size_t table_count, uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg) {
+    size_t count = usable_count(table_count);
+
     // Ignore queueing if the table isn't valid, it's a zero-time delay, or the token is not valid
-    if (!table || table_count == 0 || delay_ms == 0 || !callback) {
+    if (!table || count == 0 || delay_ms == 0 || !callback) {
         return INVALID_DEFERRED_TOKEN;
     }
 
-    // Find an unused slot and claim it
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == INVALID_DEFERRED_TOKEN) {
-            // Work out the new token value, dropping out if none were available
-            deferred_token token = allocate_token(table, table_count);
-            if (token == INVALID_DEFERRED_TOKEN) {
-                return false;
-            }
-
-            // Set up the executor table entry
-            entry->token        = current_token;
-            entry->trigger_time = timer_read32() + delay_ms;
-            entry->callback     = callback;
-            entry->cb_arg       = cb_arg;
-            return current_token;
-        }
+    // Claim the first free slot, none available if everything is pending or held
+    size_t pos = table[0].heap_count + table[0].held_count;
+    if (pos >= count) {
+        return INVALID_DEFERRED_TOKEN;
     }
 
-    // None available
-    return INVALID_DEFERRED_TOKEN;
+    // The new executor joins the end of the heap, moving the held executor in the way to the end of the held ones
+    swap_positions(table, pos, table[0].heap_count);
+    pos = table[0].heap_count++;
+
+    // Work out the new token value, the generation keeps recently released tokens from being reused straight away
+    size_t               slot        = slot_at(table, pos);
+    size_t               generations = DEFERRED_TOKEN_MAX / count;
+    deferred_executor_t *entry       = &table[slot];
+
+    // Set up the executor table entry
+    entry->token        = slot + 1 + (current_generation++ % generations) * count;
+    entry->trigger_time = timer_read32() + delay_ms;
+    entry->callback     = callback;
+    entry->cb_arg       = cb_arg;
+    sift_up(table, pos);
+    return entry->token;
 }
 
 bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token, uint32_t delay_ms) {
@@ -79,17 +166,18 @@ bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     }
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, extend the delay
-            entry->trigger_time = timer_read32() + delay_ms;
-            return true;
-        }
+    deferred_executor_t *entry = find_entry(table, table_count, token);
+    if (!entry) {
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, extend the delay. Held executors are requeued at the end of the current tick anyway.
+    entry->trigger_time = timer_read32() + delay_ms;
+    size_t pos          = position_of(table, entry - table);
+    if (pos < table[0].heap_count) {
+        heap_update(table, pos);
+    }
+    return true;
 }
 
 bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token) {
@@ -99,60 +187,73 @@ bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     }
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, cancel and clear the table entry
-            entry->token        = INVALID_DEFERRED_TOKEN;
-            entry->trigger_time = 0;
-            entry->callback     = NULL;
-            entry->cb_arg       = NULL;
-            return true;
-        }
+    deferred_executor_t *entry = find_entry(table, table_count, token);
+    if (!entry) {
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, cancel and clear the table entry
+    release_entry(table, entry);
+    return true;
 }
 
 void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time) {
+    if (!table || table_count == 0) {
+        return;
+    }
+
     uint32_t now = timer_read32();
 
     // Throttle only once per millisecond
     if (((int32_t)TIMER_DIFF_32(now, (*last_execution_time))) > 0) {
         *last_execution_time = now;
 
-        // Run through each of the executors
-        for (int i = 0; i < table_count; ++i) {
-            deferred_executor_t *entry      = &table[i];
+        // Run through the executors that are due, earliest first
+        while (table[0].heap_count > 0) {
+            size_t               slot       = slot_at(table, 0);
+            deferred_executor_t *entry      = &table[slot];
             deferred_token       curr_token = entry->token;
 
-            // Check if we're supposed to execute this entry
-            if (curr_token != INVALID_DEFERRED_TOKEN && ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0) {
-                // Invoke the callback and work work out if we should be requeued
-                uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
+            if (((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) > 0) {
+                break;
+            }
 
-                // If the token has changed, then the callback has canceled and re-queued. Skip further processing.
-                if (entry->token != curr_token) {
-                    continue;
-                }
+            // Invoke the callback and work work out if we should be requeued
+            uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
+
+            // If the token has changed, then the callback has canceled and re-queued. Skip further processing.
+            if (entry->token != curr_token) {
+                continue;
+            }
 
-                // Update the trigger time if we have to repeat, otherwise clear it out
-                if (delay_ms > 0) {
-                    // Intentionally add just the delay to the existing trigger time -- this ensures the next
-                    // invocation is with respect to the previous trigger, rather than when it got to execution. Under
-                    // normal circumstances this won't cause issue, but if another executor is invoked that takes a
-                    // considerable length of time, then this ensures best-effort timing between invocations.
-                    entry->trigger_time += delay_ms;
+            // Update the trigger time if we have to repeat, otherwise clear it out
+            if (delay_ms > 0) {
+                // Intentionally add just the delay to the existing trigger time -- this ensures the next
+                // invocation is with respect to the previous trigger, rather than when it got to execution. Under
+                // normal circumstances this won't cause issue, but if another executor is invoked that takes a
+                // considerable length of time, then this ensures best-effort timing between invocations.
+                entry->trigger_time += delay_ms;
+
+                // The callback may have extended itself, so look its position up again
+                size_t pos = position_of(table, slot);
+                if (((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0) {
+                    // Still due, hold it back until the next tick so each executor runs at most once per tick
+                    heap_remove(table, pos);
+                    table[0].held_count++;
                 } else {
-                    // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
-                    entry->token        = INVALID_DEFERRED_TOKEN;
-                    entry->trigger_time = 0;
-                    entry->callback     = NULL;
-                    entry->cb_arg       = NULL;
+                    heap_update(table, pos);
                 }
+            } else {
+                // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
+                release_entry(table, entry);
             }
         }
+
+        // Requeue the held executors, they directly follow the heap
+        while (table[0].held_count > 0) {
+            table[0].held_count--;
+            sift_up(table, table[0].heap_count++);
+        }
     }
 }
 
@@ -11,10 +11,22 @@
 // Common
 //------------------------------------
 
+/**
+ * @def The number of deferred executions available through the basic API.
+ */
+#ifndef MAX_DEFERRED_EXECUTORS
+#    define MAX_DEFERRED_EXECUTORS 8
+#endif
+
 /**
  * @typedef A token that can be used to cancel or extend an existing deferred execution.
+ * @brief Widened to 16 bits when more than 255 basic executors are configured, a table never uses more executors than there are tokens.
  */
+#if MAX_DEFERRED_EXECUTORS > 255
+typedef uint16_t deferred_token;
+#else
 typedef uint8_t deferred_token;
+#endif
 
 /**
  * @def The constant used to denote an invalid deferred execution token.
@@ -76,6 +88,10 @@ void deferred_exec_task(void);
  */
 typedef struct deferred_executor_t {
     deferred_token         token;
+    deferred_token         heap_slot;  // trigger time ordering, see deferred_exec.c
+    deferred_token         heap_pos;
+    deferred_token         heap_count; // only used in the first entry of a table
+    deferred_token         held_count;
     uint32_t               trigger_time;
     deferred_exec_callback callback;
     void *                 cb_arg;
@@ -21,6 +21,13 @@
 #include "send_string.h"
 #include "keycodes.h"
 #include "nvm_dynamic_keymap.h"
+#include "compiler_support.h"
+
+#ifdef DYNAMIC_KEYMAP_CACHE_ENABLE
+#    include <string.h>
+#    include "timer.h"
+#    include "util.h"
+#endif
 
 #ifdef ENCODER_ENABLE
 #    include "encoder.h"
@@ -32,19 +39,192 @@
 #    define DYNAMIC_KEYMAP_MACRO_DELAY TAP_CODE_DELAY
 #endif
 
+#ifndef DYNAMIC_KEYMAP_MACRO_PREFETCH_SIZE
+#    define DYNAMIC_KEYMAP_MACRO_PREFETCH_SIZE 16
+#endif
+
+STATIC_ASSERT(DYNAMIC_KEYMAP_MACRO_PREFETCH_SIZE > 0 && DYNAMIC_KEYMAP_MACRO_PREFETCH_SIZE <= 255, "DYNAMIC_KEYMAP_MACRO_PREFETCH_SIZE must be between 1 and 255");
+
+#define DYNAMIC_KEYMAP_MACRO_NONE UINT16_MAX
+
+// Start offset of each macro in the buffer, rebuilt whenever the buffer changes
+static uint16_t macro_index[DYNAMIC_KEYMAP_MACRO_COUNT];
+static bool     macro_index_valid  = false;
+static bool     macro_buffer_ready = false;
+
 uint8_t dynamic_keymap_get_layer_count(void) {
     return DYNAMIC_KEYMAP_LAYER_COUNT;
 }
 
+#ifdef DYNAMIC_KEYMAP_CACHE_ENABLE
+
+#    ifndef DYNAMIC_KEYMAP_CACHE_PAGE_SIZE
+#        define DYNAMIC_KEYMAP_CACHE_PAGE_SIZE 32
+#    endif
+
+#    ifndef DYNAMIC_KEYMAP_CACHE_FLUSH_DELAY
+#        define DYNAMIC_KEYMAP_CACHE_FLUSH_DELAY 500
+#    endif
+
+#    define DYNAMIC_KEYMAP_SIZE (DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2)
+#    define DYNAMIC_KEYMAP_CACHE_PAGES ((DYNAMIC_KEYMAP_SIZE + DYNAMIC_KEYMAP_CACHE_PAGE_SIZE - 1) / DYNAMIC_KEYMAP_CACHE_PAGE_SIZE)
+
+// Mirror of the keymap in its NVM layout, big endian keycodes ordered by layer/row/column
+static uint8_t  keymap_cache[DYNAMIC_KEYMAP_SIZE];
+static uint8_t  keymap_dirty_pages[(DYNAMIC_KEYMAP_CACHE_PAGES + 7) / 8];
+static bool     cache_loaded     = false;
+static bool     cache_dirty      = false;
+static uint16_t cache_last_write = 0;
+
+#    ifdef ENCODER_MAP_ENABLE
+#        define DYNAMIC_KEYMAP_ENCODER_ENTRIES (DYNAMIC_KEYMAP_LAYER_COUNT * NUM_ENCODERS * 2)
+
+static uint16_t encoder_cache[DYNAMIC_KEYMAP_ENCODER_ENTRIES];
+static uint8_t  encoder_dirty[(DYNAMIC_KEYMAP_ENCODER_ENTRIES + 7) / 8];
+
+static inline uint16_t dynamic_keymap_encoder_index(uint8_t layer, uint8_t encoder_id, bool clockwise) {
+    return (layer * NUM_ENCODERS + encoder_id) * 2 + (clockwise ? 0 : 1);
+}
+#    endif // ENCODER_MAP_ENABLE
+
+static void dynamic_keymap_cache_load(void) {
+    if (cache_loaded) {
+        return;
+    }
+    nvm_dynamic_keymap_read_buffer(0, DYNAMIC_KEYMAP_SIZE, keymap_cache);
+    memset(keymap_dirty_pages, 0, sizeof(keymap_dirty_pages));
+#    ifdef ENCODER_MAP_ENABLE
+    for (uint8_t layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
+        for (uint8_t encoder = 0; encoder < NUM_ENCODERS; encoder++) {
+            encoder_cache[dynamic_keymap_encoder_index(layer, encoder, true)]  = nvm_dynamic_keymap_read_encoder(layer, encoder, true);
+            encoder_cache[dynamic_keymap_encoder_index(layer, encoder, false)] = nvm_dynamic_keymap_read_encoder(layer, encoder, false);
+        }
+    }
+    memset(encoder_dirty, 0, sizeof(encoder_dirty));
+#    endif // ENCODER_MAP_ENABLE
+    cache_loaded = true;
+    cache_dirty  = false;
+}
+
+static void dynamic_keymap_cache_write(uint16_t offset, uint16_t size, const uint8_t *data) {
+    dynamic_keymap_cache_load();
+    for (uint16_t i = 0; i < size && offset + i < DYNAMIC_KEYMAP_SIZE; i++) {
+        if (keymap_cache[offset + i] != data[i]) {
+            const uint16_t page      = (offset + i) / DYNAMIC_KEYMAP_CACHE_PAGE_SIZE;
+            keymap_cache[offset + i] = data[i];
+            keymap_dirty_pages[page / 8] |= 1 << (page % 8);
+            cache_dirty = true;
+        }
+    }
+    cache_last_write = timer_read();
+}
+
+/**
+ * @brief Writes back one dirty page, or encoder entry.
+ *
+ * @return false Nothing was left to write
+ */
+static bool dynamic_keymap_cache_flush_one(void) {
+    for (uint16_t page = 0; page < DYNAMIC_KEYMAP_CACHE_PAGES; page++) {
+        if (keymap_dirty_pages[page / 8] & (1 << (page % 8))) {
+            const uint16_t offset = page * DYNAMIC_KEYMAP_CACHE_PAGE_SIZE;
+            keymap_dirty_pages[page / 8] &= ~(1 << (page % 8));
+            nvm_dynamic_keymap_update_buffer(offset, MIN(DYNAMIC_KEYMAP_CACHE_PAGE_SIZE, DYNAMIC_KEYMAP_SIZE - offset), &keymap_cache[offset]);
+            return true;
+        }
+    }
+#    ifdef ENCODER_MAP_ENABLE
+    for (uint16_t index = 0; index < DYNAMIC_KEYMAP_ENCODER_ENTRIES; index++) {
+        if (encoder_dirty[index / 8] & (1 << (index % 8))) {
+            encoder_dirty[index / 8] &= ~(1 << (index % 8));
+            nvm_dynamic_keymap_update_encoder(index / 2 / NUM_ENCODERS, (index / 2) % NUM_ENCODERS, (index % 2) == 0, encoder_cache[index]);
+            return true;
+        }
+    }
+#    endif // ENCODER_MAP_ENABLE
+    return false;
+}
+
+void dynamic_keymap_flush(void) {
+    while (dynamic_keymap_cache_flush_one()) {
+    }
+    cache_dirty = false;
+}
+
+void dynamic_keymap_task(void) {
+    // Let a burst of host edits settle first, then write back a page per call
+    if (!cache_dirty || timer_elapsed(cache_last_write) < DYNAMIC_KEYMAP_CACHE_FLUSH_DELAY) {
+        return;
+    }
+    if (!dynamic_keymap_cache_flush_one()) {
+        cache_dirty = false;
+    }
+}
+
+uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column) {
+    if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
+    dynamic_keymap_cache_load();
+    const uint8_t *keycode = &keymap_cache[((layer * MATRIX_ROWS + row) * MATRIX_COLS + column) * 2];
+    return (keycode[0] << 8) | keycode[1];
+}
+
+void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
+    if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return;
+    const uint8_t data[2] = {keycode >> 8, keycode & 0xFF};
+    dynamic_keymap_cache_write(((layer * MATRIX_ROWS + row) * MATRIX_COLS + column) * 2, sizeof(data), data);
+#    ifdef LAYER_TRANSPARENCY_MASK
+    layer_transparency_mask_invalidate();
+#    endif
+}
+
+#    ifdef ENCODER_MAP_ENABLE
+uint16_t dynamic_keymap_get_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise) {
+    if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return KC_NO;
+    dynamic_keymap_cache_load();
+    return encoder_cache[dynamic_keymap_encoder_index(layer, encoder_id, clockwise)];
+}
+
+void dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise, uint16_t keycode) {
+    if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return;
+    dynamic_keymap_cache_load();
+    const uint16_t index = dynamic_keymap_encoder_index(layer, encoder_id, clockwise);
+    if (encoder_cache[index] != keycode) {
+        encoder_cache[index] = keycode;
+        encoder_dirty[index / 8] |= 1 << (index % 8);
+        cache_dirty = true;
+    }
+    cache_last_write = timer_read();
+}
+#    endif // ENCODER_MAP_ENABLE
+
+void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+    dynamic_keymap_cache_load();
+    for (uint16_t i = 0; i < size; i++) {
+        data[i] = offset + i < DYNAMIC_KEYMAP_SIZE ? keymap_cache[offset + i] : 0x00;
+    }
+}
+
+void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+    dynamic_keymap_cache_write(offset, size, data);
+#    ifdef LAYER_TRANSPARENCY_MASK
+    layer_transparency_mask_invalidate();
+#    endif
+}
+
+#else // DYNAMIC_KEYMAP_CACHE_ENABLE
+
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column) {
     return nvm_dynamic_keymap_read_keycode(layer, row, column);
 }
 
 void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
     nvm_dynamic_keymap_update_keycode(layer, row, column, keycode);
+#    ifdef LAYER_TRANSPARENCY_MASK
+    layer_transparency_mask_invalidate();
+#    endif
 }
 
-#ifdef ENCODER_MAP_ENABLE
+#    ifdef ENCODER_MAP_ENABLE
 uint16_t dynamic_keymap_get_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise) {
     return nvm_dynamic_keymap_read_encoder(layer, encoder_id, clockwise);
 }
@@ -52,11 +232,30 @@ uint16_t dynamic_keymap_get_encoder(uint8_t layer, uint8_t encoder_id, bool cloc
 void dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise, uint16_t keycode) {
     nvm_dynamic_keymap_update_encoder(layer, encoder_id, clockwise, keycode);
 }
-#endif // ENCODER_MAP_ENABLE
+#    endif // ENCODER_MAP_ENABLE
+
+void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+    nvm_dynamic_keymap_read_buffer(offset, size, data);
+}
+
+void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+    nvm_dynamic_keymap_update_buffer(offset, size, data);
+#    ifdef LAYER_TRANSPARENCY_MASK
+    layer_transparency_mask_invalidate();
+#    endif
+}
+
+#endif // DYNAMIC_KEYMAP_CACHE_ENABLE
 
 void dynamic_keymap_reset(void) {
     // Erase the keymaps, if necessary.
     nvm_dynamic_keymap_erase();
+#ifdef DYNAMIC_KEYMAP_CACHE_ENABLE
+    // The NVM may have been erased underneath the cache, reload so every difference gets written back
+    cache_loaded = false;
+#endif // DYNAMIC_KEYMAP_CACHE_ENABLE
+    // eeconfig_init() wipes the macros along with the keymaps
+    macro_index_valid = false;
 
     // Reset the keymaps in EEPROM to what is in flash.
     for (int layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
@@ -74,14 +273,6 @@ void dynamic_keymap_reset(void) {
     }
 }
 
-void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    nvm_dynamic_keymap_read_buffer(offset, size, data);
-}
-
-void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    nvm_dynamic_keymap_update_buffer(offset, size, data);
-}
-
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
     if (layer_num < DYNAMIC_KEYMAP_LAYER_COUNT && row < MATRIX_ROWS && column < MATRIX_COLS) {
         return dynamic_keymap_get_keycode(layer_num, row, column);
@@ -110,31 +301,66 @@ void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *da
     nvm_dynamic_keymap_macro_read_buffer(offset, size, data);
 }
 
-void dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    nvm_dynamic_keymap_macro_update_buffer(offset, size, data);
+static void dynamic_keymap_macro_index_build(void) {
+    uint32_t end = nvm_dynamic_keymap_macro_size();
+    uint8_t  block[DYNAMIC_KEYMAP_MACRO_PREFETCH_SIZE];
+    uint8_t  id = 0;
+
+    // Check the last byte of the buffer.
+    // If it's not zero, then we are in the middle
+    // of buffer writing, possibly an aborted buffer
+    // write. So macro sending stays disabled.
+    nvm_dynamic_keymap_macro_read_buffer(end - 1, 1, block);
+    macro_buffer_ready = block[0] == 0;
+
+    // Each null character ends a macro, the next one starts right after it
+    macro_index[0] = 0;
+    for (uint32_t offset = 0; offset < end && id + 1 < DYNAMIC_KEYMAP_MACRO_COUNT; offset += sizeof(block)) {
+        nvm_dynamic_keymap_macro_read_buffer(offset, sizeof(block), block);
+        for (uint8_t i = 0; i < sizeof(block) && offset + i < end && id + 1 < DYNAMIC_KEYMAP_MACRO_COUNT; i++) {
+            if (block[i] == 0) {
+                macro_index[++id] = offset + i + 1;
+            }
+        }
+    }
+    // There is no Nth macro past the last null character
+    while (++id < DYNAMIC_KEYMAP_MACRO_COUNT) {
+        macro_index[id] = DYNAMIC_KEYMAP_MACRO_NONE;
+    }
+    macro_index_valid = true;
 }
 
-static uint8_t dynamic_keymap_read_byte(uint32_t offset) {
-    uint8_t d;
-    nvm_dynamic_keymap_macro_read_buffer(offset, 1, &d);
-    return d;
+void dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+    nvm_dynamic_keymap_macro_update_buffer(offset, size, data);
+    macro_index_valid = false;
+    // The final write of a transfer clears the last byte, index the new macros straight away
+    if ((uint32_t)offset + size >= nvm_dynamic_keymap_macro_size()) {
+        dynamic_keymap_macro_index_build();
+    }
 }
 
 typedef struct send_string_nvm_state_t {
     uint32_t offset;
+    uint8_t  position;
+    uint8_t  buffer[DYNAMIC_KEYMAP_MACRO_PREFETCH_SIZE];
 } send_string_nvm_state_t;
 
 char send_string_get_next_nvm(void *arg) {
     send_string_nvm_state_t *state = (send_string_nvm_state_t *)arg;
-    char                     ret   = dynamic_keymap_read_byte(state->offset);
-    state->offset++;
-    return ret;
+    // Prefetch a block at a time, reads past the end of the buffer return nulls
+    if (state->position == sizeof(state->buffer)) {
+        nvm_dynamic_keymap_macro_read_buffer(state->offset, sizeof(state->buffer), state->buffer);
+        state->offset += sizeof(state->buffer);
+        state->position = 0;
+    }
+    return state->buffer[state->position++];
 }
 
 void dynamic_keymap_macro_reset(void) {
     // Erase the macros, if necessary.
     nvm_dynamic_keymap_macro_erase();
     nvm_dynamic_keymap_macro_reset();
+    macro_index_valid = false;
 }
 
 void dynamic_keymap_macro_send(uint8_t id) {
@@ -142,30 +368,13 @@ void dynamic_keymap_macro_send(uint8_t id) {
         return;
     }
 
-    // Check the last byte of the buffer.
-    // If it's not zero, then we are in the middle
-    // of buffer writing, possibly an aborted buffer
-    // write. So do nothing.
-    if (dynamic_keymap_read_byte(nvm_dynamic_keymap_macro_size() - 1) != 0) {
-        return;
+    if (!macro_index_valid) {
+        dynamic_keymap_macro_index_build();
     }
-
-    // Skip N null characters
-    // p will then point to the Nth macro
-    uint32_t offset = 0;
-    uint32_t end    = nvm_dynamic_keymap_macro_size();
-    while (id > 0) {
-        // If we are past the end of the buffer, then there is
-        // no Nth macro in the buffer.
-        if (offset == end) {
-            return;
-        }
-        if (dynamic_keymap_read_byte(offset) == 0) {
-            --id;
-        }
-        ++offset;
+    if (!macro_buffer_ready || macro_index[id] == DYNAMIC_KEYMAP_MACRO_NONE) {
+        return;
     }
 
-    send_string_nvm_state_t state = {.offset = offset};
+    send_string_nvm_state_t state = {.offset = macro_index[id], .position = DYNAMIC_KEYMAP_MACRO_PREFETCH_SIZE};
     send_string_with_delay_impl(send_string_get_next_nvm, &state, DYNAMIC_KEYMAP_MACRO_DELAY);
 }
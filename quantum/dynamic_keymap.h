@@ -45,6 +45,15 @@ void dynamic_keymap_reset(void);
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data);
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data);
 
+#ifdef DYNAMIC_KEYMAP_CACHE_ENABLE
+// With the cache, the keymap and encoder map are served from RAM and changes
+// are written back a page at a time by dynamic_keymap_task(), once no change
+// has been made for DYNAMIC_KEYMAP_CACHE_FLUSH_DELAY ms.
+// dynamic_keymap_flush() writes back everything right away.
+void dynamic_keymap_task(void);
+void dynamic_keymap_flush(void);
+#endif // DYNAMIC_KEYMAP_CACHE_ENABLE
+
 // This overrides the one in quantum/keymap_common.c
 // uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key);
 
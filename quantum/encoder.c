@@ -16,15 +16,21 @@ __attribute__((weak)) bool should_process_encoder(void) {
 
 static encoder_events_t encoder_events;
 static bool             signal_queue_drain = false;
+static uint8_t          drain_dequeued     = 0;
 
 void encoder_init(void) {
     memset(&encoder_events, 0, sizeof(encoder_events));
     encoder_driver_init();
 }
 
-static void encoder_queue_drain(void) {
-    encoder_events.tail     = encoder_events.head;
-    encoder_events.dequeued = encoder_events.enqueued;
+static void encoder_queue_drain(uint8_t dequeued) {
+    // Only drop the events that were handed over, later ones are still to be sent
+    uint8_t count = dequeued - encoder_events.dequeued;
+    if (count > (uint8_t)(encoder_events.enqueued - encoder_events.dequeued)) {
+        return;
+    }
+    encoder_events.tail     = (encoder_events.tail + count) % MAX_QUEUED_ENCODER_EVENTS;
+    encoder_events.dequeued = dequeued;
 }
 
 static bool encoder_handle_queue(void) {
@@ -68,7 +74,7 @@ bool encoder_task(void) {
 
     if (signal_queue_drain) {
         signal_queue_drain = false;
-        encoder_queue_drain();
+        encoder_queue_drain(drain_dequeued);
     }
 
     // Let the encoder driver produce events
@@ -144,7 +150,8 @@ void encoder_retrieve_events(encoder_events_t *events) {
     memcpy(events, &encoder_events, sizeof(encoder_events));
 }
 
-void encoder_signal_queue_drain(void) {
+void encoder_signal_queue_drain(uint8_t dequeued) {
+    drain_dequeued     = dequeued;
     signal_queue_drain = true;
 }
 
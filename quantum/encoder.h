@@ -106,8 +106,8 @@ void encoder_retrieve_events(encoder_events_t *events);
 bool encoder_queue_event_advanced(encoder_events_t *events, uint8_t index, bool clockwise);
 bool encoder_dequeue_event_advanced(encoder_events_t *events, uint8_t *index, bool *clockwise);
 
-// Reset the queue to be empty
-void encoder_signal_queue_drain(void);
+// Drop queued events up to the given dequeue count
+void encoder_signal_queue_drain(uint8_t dequeued);
 
 #    ifdef ENCODER_MAP_ENABLE
 #        define NUM_DIRECTIONS 2
@@ -16,6 +16,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include <stdint.h>
+#include <string.h>
 #include "keyboard.h"
 #include "keycode_config.h"
 #include "matrix.h"
@@ -32,6 +33,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "sendchar.h"
 #include "eeconfig.h"
 #include "action_layer.h"
+#include "profiling.h"
 #ifdef BOOTMAGIC_ENABLE
 #    include "bootmagic.h"
 #endif
@@ -122,9 +124,15 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef SPLIT_KEYBOARD
 #    include "split_util.h"
 #endif
+#if defined(SPLIT_COMMON_TRANSACTIONS) && defined(SPLIT_MATRIX_EVENTS_ENABLE)
+#    include "transactions.h"
+#endif
 #ifdef BATTERY_DRIVER
 #    include "battery.h"
 #endif
+#ifdef DYNAMIC_KEYMAP_ENABLE
+#    include "dynamic_keymap.h"
+#endif
 #ifdef BLUETOOTH_ENABLE
 #    include "bluetooth.h"
 #endif
@@ -563,6 +571,31 @@ void switch_events(uint8_t row, uint8_t col, bool pressed) {
 #endif
 }
 
+#ifdef MATRIX_CHANGED_ROWS
+#    define MATRIX_CTZ(bits) ((uint8_t)__builtin_ctzl((unsigned long)(bits)))
+
+// one bit per matrix row that differs from the last processed state
+static uint32_t matrix_changed_rows[(MATRIX_ROWS + 31) / 32];
+
+/**
+ * @brief Compares every row against the last processed state and records the
+ * rows that differ in matrix_changed_rows.
+ *
+ * @return true At least one row changed
+ */
+static bool matrix_collect_changed_rows(const matrix_row_t matrix_previous[]) {
+    bool changed = false;
+    memset(matrix_changed_rows, 0, sizeof(matrix_changed_rows));
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        if (matrix_previous[row] ^ matrix_get_row(row)) {
+            matrix_changed_rows[row / 32] |= (uint32_t)1 << (row % 32);
+            changed = true;
+        }
+    }
+    return changed;
+}
+#endif
+
 /**
  * @brief Generates a tick event at a maximum rate of 1KHz that drives the
  * internal QMK state machine.
@@ -576,6 +609,30 @@ static inline void generate_tick_event(void) {
     }
 }
 
+/**
+ * @brief Builds the event of a changed matrix position, timed when the split
+ * slave saw it change if known.
+ *
+ * Slave times are never earlier than the previous event, as timing a key
+ * before events already processed would break tap and hold decisions.
+ */
+static inline keyevent_t make_matrix_event(uint8_t row, uint8_t col, bool pressed) {
+    keyevent_t event = MAKE_KEYEVENT(row, col, pressed);
+#if defined(SPLIT_COMMON_TRANSACTIONS) && defined(SPLIT_MATRIX_EVENTS_ENABLE)
+    static uint32_t last_event_time = 0;
+    const uint32_t  now             = timer_read32();
+    uint16_t        slave_time;
+
+    if (split_matrix_event_time(row, col, pressed, &slave_time)) {
+        const uint32_t last_event_age = TIMER_DIFF_32(now, last_event_time);
+        const uint16_t slave_age      = TIMER_DIFF_16((uint16_t)now, slave_time);
+        event.time                    = slave_age > last_event_age ? (uint16_t)last_event_time : slave_time;
+    }
+    last_event_time = now - TIMER_DIFF_16((uint16_t)now, event.time);
+#endif
+    return event;
+}
+
 /**
  * @brief This task scans the keyboards matrix and processes any key presses
  * that occur.
@@ -591,11 +648,16 @@ static bool matrix_task(void) {
 
     static matrix_row_t matrix_previous[MATRIX_ROWS];
 
+#ifdef MATRIX_CHANGED_ROWS
+    // matrix_scan() is trusted to report changes, rows are only compared when it does
+    const bool matrix_changed = matrix_scan() && matrix_collect_changed_rows(matrix_previous);
+#else
     matrix_scan();
     bool matrix_changed = false;
     for (uint8_t row = 0; row < MATRIX_ROWS && !matrix_changed; row++) {
         matrix_changed |= matrix_previous[row] ^ matrix_get_row(row);
     }
+#endif
 
     matrix_scan_perf_task();
 
@@ -611,6 +673,32 @@ static bool matrix_task(void) {
 
     const bool process_keypress = should_process_keypress();
 
+#ifdef MATRIX_CHANGED_ROWS
+    for (uint8_t word = 0; word < ARRAY_SIZE(matrix_changed_rows); word++) {
+        for (uint32_t rows = matrix_changed_rows[word]; rows; rows &= rows - 1) {
+            const uint8_t      row         = word * 32 + MATRIX_CTZ(rows);
+            const matrix_row_t current_row = matrix_get_row(row);
+
+            if (has_ghost_in_row(row, current_row)) {
+                continue;
+            }
+
+            // jump straight to each changed column
+            for (matrix_row_t row_changes = current_row ^ matrix_previous[row]; row_changes; row_changes &= row_changes - 1) {
+                const uint8_t col         = MATRIX_CTZ(row_changes);
+                const bool    key_pressed = current_row & (MATRIX_ROW_SHIFTER << col);
+
+                if (process_keypress) {
+                    action_exec(make_matrix_event(row, col, key_pressed));
+                }
+
+                switch_events(row, col, key_pressed);
+            }
+
+            matrix_previous[row] = current_row;
+        }
+    }
+#else
     for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
         const matrix_row_t current_row = matrix_get_row(row);
         const matrix_row_t row_changes = current_row ^ matrix_previous[row];
@@ -625,7 +713,7 @@ static bool matrix_task(void) {
                 const bool key_pressed = current_row & col_mask;
 
                 if (process_keypress) {
-                    action_exec(MAKE_KEYEVENT(row, col, key_pressed));
+                    action_exec(make_matrix_event(row, col, key_pressed));
                 }
 
                 switch_events(row, col, key_pressed);
@@ -634,6 +722,7 @@ static bool matrix_task(void) {
 
         matrix_previous[row] = current_row;
     }
+#endif
 
     return matrix_changed;
 }
@@ -669,101 +758,116 @@ void quantum_task(void) {
 #endif
 
 #if defined(AUDIO_ENABLE) && !defined(NO_MUSIC_MODE)
-    music_task();
+    PROFILE_ZONE_CALL(PROFILE_ZONE_MUSIC_TASK, music_task());
 #endif
 
 #ifdef KEY_OVERRIDE_ENABLE
-    key_override_task();
+    PROFILE_ZONE_CALL(PROFILE_ZONE_KEY_OVERRIDE_TASK, key_override_task());
 #endif
 
 #ifdef SEQUENCER_ENABLE
-    sequencer_task();
+    PROFILE_ZONE_CALL(PROFILE_ZONE_SEQUENCER_TASK, sequencer_task());
 #endif
 
 #ifdef TAP_DANCE_ENABLE
-    tap_dance_task();
+    PROFILE_ZONE_CALL(PROFILE_ZONE_TAP_DANCE_TASK, tap_dance_task());
 #endif
 
 #ifdef COMBO_ENABLE
-    combo_task();
+    PROFILE_ZONE_CALL(PROFILE_ZONE_COMBO_TASK, combo_task());
 #endif
 
 #ifdef LEADER_ENABLE
-    leader_task();
+    PROFILE_ZONE_CALL(PROFILE_ZONE_LEADER_TASK, leader_task());
 #endif
 
 #ifdef WPM_ENABLE
-    decay_wpm();
+    PROFILE_ZONE_CALL(PROFILE_ZONE_DECAY_WPM, decay_wpm());
 #endif
 
 #ifdef DIP_SWITCH_ENABLE
-    dip_switch_task();
+    PROFILE_ZONE_CALL(PROFILE_ZONE_DIP_SWITCH_TASK, dip_switch_task());
 #endif
 
 #ifdef AUTO_SHIFT_ENABLE
-    autoshift_matrix_scan();
+    PROFILE_ZONE_CALL(PROFILE_ZONE_AUTOSHIFT_MATRIX_SCAN, autoshift_matrix_scan());
 #endif
 
 #ifdef CAPS_WORD_ENABLE
-    caps_word_task();
+    PROFILE_ZONE_CALL(PROFILE_ZONE_CAPS_WORD_TASK, caps_word_task());
 #endif
 
 #ifdef SECURE_ENABLE
-    secure_task();
+    PROFILE_ZONE_CALL(PROFILE_ZONE_SECURE_TASK, secure_task());
 #endif
 
 #ifdef LAYER_LOCK_ENABLE
-    layer_lock_task();
+    PROFILE_ZONE_CALL(PROFILE_ZONE_LAYER_LOCK_TASK, layer_lock_task());
+#endif
+
+#if defined(DYNAMIC_KEYMAP_ENABLE) && defined(DYNAMIC_KEYMAP_CACHE_ENABLE)
+    PROFILE_ZONE_CALL(PROFILE_ZONE_DYNAMIC_KEYMAP_TASK, dynamic_keymap_task());
 #endif
 }
 
 /** \brief Main task that is repeatedly called as fast as possible. */
 void keyboard_task(void) {
+    PROFILE_ZONE_BEGIN(PROFILE_ZONE_KEYBOARD_TASK);
+
     __attribute__((unused)) bool activity_has_occurred = false;
-    if (matrix_task()) {
+    PROFILE_ZONE_BEGIN(PROFILE_ZONE_MATRIX_TASK);
+    const bool matrix_changed = matrix_task();
+    PROFILE_ZONE_END(PROFILE_ZONE_MATRIX_TASK);
+    if (matrix_changed) {
         last_matrix_activity_trigger();
         activity_has_occurred = true;
     }
 
-    quantum_task();
+    PROFILE_ZONE_CALL(PROFILE_ZONE_QUANTUM_TASK, quantum_task());
 
 #if defined(SPLIT_WATCHDOG_ENABLE)
-    split_watchdog_task();
+    PROFILE_ZONE_CALL(PROFILE_ZONE_SPLIT_WATCHDOG_TASK, split_watchdog_task());
 #endif
 
 #if defined(RGBLIGHT_ENABLE)
-    rgblight_task();
+    PROFILE_ZONE_CALL(PROFILE_ZONE_RGBLIGHT_TASK, rgblight_task());
 #endif
 
 #ifdef LED_MATRIX_ENABLE
-    led_matrix_task();
+    PROFILE_ZONE_CALL(PROFILE_ZONE_LED_MATRIX_TASK, led_matrix_task());
 #endif
 #ifdef RGB_MATRIX_ENABLE
-    rgb_matrix_task();
+    PROFILE_ZONE_CALL(PROFILE_ZONE_RGB_MATRIX_TASK, rgb_matrix_task());
 #endif
 
 #if defined(BACKLIGHT_ENABLE)
 #    if defined(BACKLIGHT_PIN) || defined(BACKLIGHT_PINS)
-    backlight_task();
+    PROFILE_ZONE_CALL(PROFILE_ZONE_BACKLIGHT_TASK, backlight_task());
 #    endif
 #endif
 
 #ifdef ENCODER_ENABLE
-    if (encoder_task()) {
+    PROFILE_ZONE_BEGIN(PROFILE_ZONE_ENCODER_TASK);
+    const bool encoder_changed = encoder_task();
+    PROFILE_ZONE_END(PROFILE_ZONE_ENCODER_TASK);
+    if (encoder_changed) {
         last_encoder_activity_trigger();
         activity_has_occurred = true;
     }
 #endif
 
 #ifdef POINTING_DEVICE_ENABLE
-    if (pointing_device_task()) {
+    PROFILE_ZONE_BEGIN(PROFILE_ZONE_POINTING_DEVICE_TASK);
+    const bool pointing_device_changed = pointing_device_task();
+    PROFILE_ZONE_END(PROFILE_ZONE_POINTING_DEVICE_TASK);
+    if (pointing_device_changed) {
         last_pointing_device_activity_trigger();
         activity_has_occurred = true;
     }
 #endif
 
 #ifdef OLED_ENABLE
-    oled_task();
+    PROFILE_ZONE_CALL(PROFILE_ZONE_OLED_TASK, oled_task());
 #    if OLED_TIMEOUT > 0
     // Wake up oled if user is using those fabulous keys or spinning those encoders!
     if (activity_has_occurred) oled_on();
@@ -771,7 +875,7 @@ void keyboard_task(void) {
 #endif
 
 #ifdef ST7565_ENABLE
-    st7565_task();
+    PROFILE_ZONE_CALL(PROFILE_ZONE_ST7565_TASK, st7565_task());
 #    if ST7565_TIMEOUT > 0
     // Wake up display if user is using those fabulous keys or spinning those encoders!
     if (activity_has_occurred) st7565_on();
@@ -780,36 +884,42 @@ void keyboard_task(void) {
 
 #ifdef MOUSEKEY_ENABLE
     // mousekey repeat & acceleration
-    mousekey_task();
+    PROFILE_ZONE_CALL(PROFILE_ZONE_MOUSEKEY_TASK, mousekey_task());
 #endif
 
 #ifdef PS2_MOUSE_ENABLE
-    ps2_mouse_task();
+    PROFILE_ZONE_CALL(PROFILE_ZONE_PS2_MOUSE_TASK, ps2_mouse_task());
 #endif
 
 #ifdef MIDI_ENABLE
-    midi_task();
+    PROFILE_ZONE_CALL(PROFILE_ZONE_MIDI_TASK, midi_task());
 #endif
 
 #ifdef JOYSTICK_ENABLE
-    joystick_task();
+    PROFILE_ZONE_CALL(PROFILE_ZONE_JOYSTICK_TASK, joystick_task());
 #endif
 
 #ifdef BATTERY_DRIVER
-    battery_task();
+    PROFILE_ZONE_CALL(PROFILE_ZONE_BATTERY_TASK, battery_task());
 #endif
 
 #ifdef BLUETOOTH_ENABLE
-    bluetooth_task();
+    PROFILE_ZONE_CALL(PROFILE_ZONE_BLUETOOTH_TASK, bluetooth_task());
 #endif
 
 #ifdef HAPTIC_ENABLE
-    haptic_task();
+    PROFILE_ZONE_CALL(PROFILE_ZONE_HAPTIC_TASK, haptic_task());
 #endif
 
-    led_task();
+    PROFILE_ZONE_CALL(PROFILE_ZONE_LED_TASK, led_task());
 
 #ifdef OS_DETECTION_ENABLE
-    os_detection_task();
+    PROFILE_ZONE_CALL(PROFILE_ZONE_OS_DETECTION_TASK, os_detection_task());
 #endif
+
+#ifdef EEPROM_DRIVER
+    PROFILE_ZONE_CALL(PROFILE_ZONE_EEPROM_DRIVER_TASK, eeprom_driver_task());
+#endif
+
+    PROFILE_ZONE_END(PROFILE_ZONE_KEYBOARD_TASK);
 }
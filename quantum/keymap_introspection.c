@@ -177,6 +177,48 @@ __attribute__((weak)) const key_override_t* key_override_get(uint16_t key_overri
 
 #endif // defined(KEY_OVERRIDE_ENABLE)
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Leader sequences
+
+#if defined(LEADER_ENABLE)
+
+// The trie is generated from the `leader_sequences` in keymap.json, keymaps without any have an empty trie
+#    if defined(LEADER_TRIE_DEFINED)
+
+uint16_t leader_trie_count_raw(void) {
+    return ARRAY_SIZE(leader_trie);
+}
+
+bool leader_trie_get_raw(uint16_t node_idx, leader_trie_node_t* node) {
+    if (node_idx >= leader_trie_count_raw()) {
+        return false;
+    }
+    memcpy_P(node, &leader_trie[node_idx], sizeof(leader_trie_node_t));
+    return true;
+}
+
+#    else
+
+uint16_t leader_trie_count_raw(void) {
+    return 0;
+}
+
+bool leader_trie_get_raw(uint16_t node_idx, leader_trie_node_t* node) {
+    return false;
+}
+
+#    endif // defined(LEADER_TRIE_DEFINED)
+
+__attribute__((weak)) uint16_t leader_trie_count(void) {
+    return leader_trie_count_raw();
+}
+
+__attribute__((weak)) bool leader_trie_get(uint16_t node_idx, leader_trie_node_t* node) {
+    return leader_trie_get_raw(node_idx, node);
+}
+
+#endif // defined(LEADER_ENABLE)
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Community modules (must be last in this file!)
 
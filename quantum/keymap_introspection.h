@@ -109,3 +109,24 @@ const key_override_t* key_override_get_raw(uint16_t key_override_idx);
 const key_override_t* key_override_get(uint16_t key_override_idx);
 
 #endif // defined(KEY_OVERRIDE_ENABLE)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Leader sequences
+
+#if defined(LEADER_ENABLE)
+
+// Forward declaration of leader_trie_node_t so we don't need to deal with header reordering
+struct leader_trie_node_t;
+typedef struct leader_trie_node_t leader_trie_node_t;
+
+// Get the number of leader sequence trie nodes defined in the user's keymap, stored in firmware rather than any other persistent storage
+uint16_t leader_trie_count_raw(void);
+// Get the number of leader sequence trie nodes defined in the user's keymap, potentially stored dynamically
+uint16_t leader_trie_count(void);
+
+// Copy out a leader sequence trie node, stored in firmware rather than any other persistent storage
+bool leader_trie_get_raw(uint16_t node_idx, leader_trie_node_t* node);
+// Copy out a leader sequence trie node, potentially stored dynamically
+bool leader_trie_get(uint16_t node_idx, leader_trie_node_t* node);
+
+#endif // defined(LEADER_ENABLE)
@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "leader.h"
+#include "quantum.h"
+#include "keymap_introspection.h"
 #include "timer.h"
 #include "util.h"
 
@@ -17,6 +19,10 @@ uint16_t leader_time          = 0;
 uint16_t leader_sequence[5]   = {0, 0, 0, 0, 0};
 uint8_t  leader_sequence_size = 0;
 
+// Position within the leader sequence trie, if the sequence so far can still match
+#define LEADER_TRIE_NO_MATCH UINT16_MAX
+static uint16_t leader_trie_cursor = LEADER_TRIE_NO_MATCH;
+
 __attribute__((weak)) void leader_start_user(void) {}
 
 __attribute__((weak)) void leader_end_user(void) {}
@@ -25,6 +31,12 @@ __attribute__((weak)) bool leader_add_user(uint16_t keycode) {
     return false;
 }
 
+// An empty `leader_sequences` still generates the root node
+static bool leader_trie_has_sequences(void) {
+    leader_trie_node_t root;
+    return leader_trie_get(0, &root) && root.child_count > 0;
+}
+
 void leader_start(void) {
     if (leading) {
         return;
@@ -34,13 +46,42 @@ void leader_start(void) {
     leader_time          = timer_read();
     leader_sequence_size = 0;
     memset(leader_sequence, 0, sizeof(leader_sequence));
+    leader_trie_cursor = leader_trie_has_sequences() ? 0 : LEADER_TRIE_NO_MATCH;
 }
 
 void leader_end(void) {
     leading = false;
+
+    leader_trie_node_t node;
+    if (leader_trie_cursor != LEADER_TRIE_NO_MATCH && leader_trie_get(leader_trie_cursor, &node) && node.action != KC_NO) {
+        tap_code16(node.action);
+    }
+    leader_trie_cursor = LEADER_TRIE_NO_MATCH;
+
     leader_end_user();
 }
 
+// Follows the trie edge for the given keycode, returning whether no declared sequence can be extended any further
+static bool leader_trie_advance(uint16_t keycode) {
+    leader_trie_node_t node;
+    if (leader_trie_cursor == LEADER_TRIE_NO_MATCH || !leader_trie_get(leader_trie_cursor, &node)) {
+        return false;
+    }
+
+    const uint16_t last_child = node.first_child + node.child_count;
+    for (uint16_t i = node.first_child; i < last_child; ++i) {
+        if (leader_trie_get(i, &node) && node.keycode == keycode) {
+            leader_trie_cursor = i;
+            // Nothing longer can match, so there's no need to wait for more keys
+            return node.child_count == 0;
+        }
+    }
+
+    // Dead prefix, no sequence can match any more
+    leader_trie_cursor = LEADER_TRIE_NO_MATCH;
+    return true;
+}
+
 void leader_task(void) {
     if (leader_sequence_active() && leader_sequence_timed_out()) {
         leader_end();
@@ -65,7 +106,16 @@ bool leader_sequence_add(uint16_t keycode) {
     leader_sequence[leader_sequence_size] = keycode;
     leader_sequence_size++;
 
-    if (leader_add_user(keycode)) {
+    const bool trie_complete = leader_trie_advance(keycode);
+    bool       end           = leader_add_user(keycode);
+#if defined(LEADER_SEQUENCES_END_EARLY)
+    // Only declared sequences are in use, so there's no need to wait once they are decided
+    end |= trie_complete;
+#else
+    // Sequences in leader_end_user() may still want more keys
+    (void)trie_complete;
+#endif
+    if (end) {
         leader_end();
     }
     return true;
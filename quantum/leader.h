@@ -1,6 +1,8 @@
 // Copyright 2023 QMK
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#pragma once
+
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -11,6 +13,18 @@
  * \{
  */
 
+/**
+ * \brief A node of the leader sequence trie, generated from the `leader_sequences` declared in `keymap.json`.
+ *
+ * The root node is at index 0, and the children of each node are stored contiguously.
+ */
+typedef struct leader_trie_node_t {
+    uint16_t keycode;     // The keycode leading from the parent node to this node
+    uint16_t action;      // The keycode to tap when the sequence ends at this node, or `KC_NO`
+    uint16_t first_child; // The index of the first child node
+    uint8_t  child_count; // The number of child nodes
+} leader_trie_node_t;
+
 /**
  * \brief User callback, invoked when the leader sequence begins.
  */
@@ -37,6 +51,8 @@ void leader_start(void);
 
 /**
  * End the leader sequence.
+ *
+ * If the sequence matches one declared in `keymap.json`, its keycode is tapped.
  */
 void leader_end(void);
 
@@ -52,6 +68,9 @@ bool leader_sequence_active(void);
  *
  * If `LEADER_NO_TIMEOUT` is defined, the timer is reset if the buffer is empty.
  *
+ * If `LEADER_SEQUENCES_END_EARLY` is defined and sequences are declared in `keymap.json`, the sequence ends as soon as it
+ * either matches a sequence which no other sequence starts with, or can no longer match any sequence.
+ *
  * \param keycode The keycode to add.
  *
  * \return `true` if the keycode was added, `false` if the buffer is full.
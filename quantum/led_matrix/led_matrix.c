@@ -68,6 +68,7 @@ uint8_t g_led_frame_buffer[MATRIX_ROWS][MATRIX_COLS] = {{0}};
 #endif // LED_MATRIX_FRAMEBUFFER_EFFECTS
 #ifdef LED_MATRIX_KEYREACTIVE_ENABLED
 last_hit_t g_last_hit_tracker;
+uint8_t    g_last_hit_led[LED_MATRIX_LED_COUNT];
 #endif // LED_MATRIX_KEYREACTIVE_ENABLED
 
 // internals
@@ -80,7 +81,13 @@ static led_task_states led_task_state    = SYNCING;
 // double buffers
 static uint32_t led_timer_buffer;
 #ifdef LED_MATRIX_KEYREACTIVE_ENABLED
+// ring of the remembered hits, oldest at last_hit_head
 static last_hit_t last_hit_buffer;
+static uint8_t    last_hit_head = 0;
+
+static inline uint8_t last_hit_next(uint8_t index) {
+    return index + 1 < LED_HITS_TO_REMEMBER ? index + 1 : 0;
+}
 #endif // LED_MATRIX_KEYREACTIVE_ENABLED
 
 // split led matrix
@@ -188,21 +195,21 @@ void led_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed) {
         led_count = led_matrix_map_row_column_to_led(row, col, led);
     }
 
-    if (last_hit_buffer.count + led_count > LED_HITS_TO_REMEMBER) {
-        memcpy(&last_hit_buffer.x[0], &last_hit_buffer.x[led_count], LED_HITS_TO_REMEMBER - led_count);
-        memcpy(&last_hit_buffer.y[0], &last_hit_buffer.y[led_count], LED_HITS_TO_REMEMBER - led_count);
-        memcpy(&last_hit_buffer.tick[0], &last_hit_buffer.tick[led_count], (LED_HITS_TO_REMEMBER - led_count) * 2); // 16 bit
-        memcpy(&last_hit_buffer.index[0], &last_hit_buffer.index[led_count], LED_HITS_TO_REMEMBER - led_count);
-        last_hit_buffer.count = LED_HITS_TO_REMEMBER - led_count;
-    }
-
     for (uint8_t i = 0; i < led_count; i++) {
-        uint8_t index                = last_hit_buffer.count;
+        uint16_t index = last_hit_head + last_hit_buffer.count;
+        if (index >= LED_HITS_TO_REMEMBER) {
+            index -= LED_HITS_TO_REMEMBER;
+        }
+        // a full ring overwrites the oldest hit
+        if (last_hit_buffer.count < LED_HITS_TO_REMEMBER) {
+            last_hit_buffer.count++;
+        } else {
+            last_hit_head = last_hit_next(last_hit_head);
+        }
         last_hit_buffer.x[index]     = g_led_config.point[led[i]].x;
         last_hit_buffer.y[index]     = g_led_config.point[led[i]].y;
         last_hit_buffer.index[index] = led[i];
         last_hit_buffer.tick[index]  = 0;
-        last_hit_buffer.count++;
     }
 #endif // LED_MATRIX_KEYREACTIVE_ENABLED
 
@@ -231,12 +238,16 @@ static void led_task_timers(void) {
     // Update double buffer last hit timers
 #ifdef LED_MATRIX_KEYREACTIVE_ENABLED
     uint8_t count = last_hit_buffer.count;
+    uint8_t index = last_hit_head;
     for (uint8_t i = 0; i < count; ++i) {
-        if (UINT16_MAX - deltaTime < last_hit_buffer.tick[i]) {
+        // hits age together, so the oldest ones are the first to expire
+        if (UINT16_MAX - deltaTime < last_hit_buffer.tick[index]) {
+            last_hit_head = last_hit_next(last_hit_head);
             last_hit_buffer.count--;
-            continue;
+        } else {
+            last_hit_buffer.tick[index] += deltaTime;
         }
-        last_hit_buffer.tick[i] += deltaTime;
+        index = last_hit_next(index);
     }
 #endif // LED_MATRIX_KEYREACTIVE_ENABLED
 }
@@ -247,6 +258,27 @@ static void led_task_sync(void) {
     if (sync_timer_elapsed32(g_led_timer) >= LED_MATRIX_LED_FLUSH_LIMIT) led_task_state = STARTING;
 }
 
+#ifdef LED_MATRIX_KEYREACTIVE_ENABLED
+// Unrolls the ring into g_last_hit_tracker, oldest hit first, and points g_last_hit_led at each LED's latest hit
+static void last_hit_update_tracker(void) {
+    for (uint8_t i = 0; i < g_last_hit_tracker.count; ++i) {
+        g_last_hit_led[g_last_hit_tracker.index[i]] = LAST_HIT_NONE;
+    }
+
+    uint8_t index            = last_hit_head;
+    g_last_hit_tracker.count = last_hit_buffer.count;
+    for (uint8_t i = 0; i < g_last_hit_tracker.count; ++i) {
+        g_last_hit_tracker.x[i]                      = last_hit_buffer.x[index];
+        g_last_hit_tracker.y[i]                      = last_hit_buffer.y[index];
+        g_last_hit_tracker.index[i]                  = last_hit_buffer.index[index];
+        g_last_hit_tracker.tick[i]                   = last_hit_buffer.tick[index];
+        g_last_hit_led[last_hit_buffer.index[index]] = i;
+
+        index = last_hit_next(index);
+    }
+}
+#endif // LED_MATRIX_KEYREACTIVE_ENABLED
+
 static void led_task_start(void) {
     // reset iter
     led_effect_params.iter = 0;
@@ -254,7 +286,7 @@ static void led_task_start(void) {
     // update double buffers
     g_led_timer = led_timer_buffer;
 #ifdef LED_MATRIX_KEYREACTIVE_ENABLED
-    g_last_hit_tracker = last_hit_buffer;
+    last_hit_update_tracker();
 #endif // LED_MATRIX_KEYREACTIVE_ENABLED
 
     // next task
@@ -447,7 +479,10 @@ void led_matrix_init(void) {
         g_last_hit_tracker.tick[i] = UINT16_MAX;
     }
 
+    memset(g_last_hit_led, LAST_HIT_NONE, sizeof(g_last_hit_led));
+
     last_hit_buffer.count = 0;
+    last_hit_head         = 0;
     for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
         last_hit_buffer.tick[i] = UINT16_MAX;
     }
@@ -202,6 +202,8 @@ extern uint32_t     g_led_timer;
 extern led_config_t g_led_config;
 #ifdef LED_MATRIX_KEYREACTIVE_ENABLED
 extern last_hit_t g_last_hit_tracker;
+// Position of the most recent hit of each LED in g_last_hit_tracker, or LAST_HIT_NONE
+extern uint8_t g_last_hit_led[LED_MATRIX_LED_COUNT];
 #endif
 #ifdef LED_MATRIX_FRAMEBUFFER_EFFECTS
 extern uint8_t g_led_frame_buffer[MATRIX_ROWS][MATRIX_COLS];
@@ -2,6 +2,26 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "qp_comms.h"
+#include "qp_draw.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Asynchronous transfer tracking
+//
+// Only the global pixdata buffers are ever transmitted asynchronously, and only one transfer may be in flight at any
+// point in time -- any other comms operation waits for it to complete first, so that commands, D/C pin changes and bus
+// release are correctly ordered after the pixel data.
+
+static volatile bool qp_comms_async_pending = false;
+
+static void qp_comms_async_complete(painter_device_t device) {
+    qp_comms_async_pending = false;
+}
+
+void qp_comms_wait(painter_device_t device) {
+    while (qp_comms_async_pending) {
+        // Wait for the in-flight transfer to complete.
+    }
+}
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Base comms APIs
@@ -33,6 +53,7 @@ void qp_comms_stop(painter_device_t device) {
         return;
     }
 
+    qp_comms_wait(device);
     driver->comms_vtable->comms_stop(device);
 }
 
@@ -43,6 +64,19 @@ uint32_t qp_comms_send(painter_device_t device, const void *data, uint32_t byte_
         return false;
     }
 
+    qp_comms_wait(device);
+
+#if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+    // Pixel data gets sent in the background if possible, the caller swaps to the other pixdata buffer in the meantime
+    if (driver->comms_vtable->comms_send_async && qp_internal_is_pixdata_buffer(data)) {
+        qp_comms_async_pending = true;
+        if (driver->comms_vtable->comms_send_async(device, data, byte_count, qp_comms_async_complete)) {
+            return byte_count;
+        }
+        qp_comms_async_pending = false;
+    }
+#endif // QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+
     return driver->comms_vtable->comms_send(device, data, byte_count);
 }
 
@@ -52,6 +86,7 @@ uint32_t qp_comms_send(painter_device_t device, const void *data, uint32_t byte_
 void qp_comms_command(painter_device_t device, uint8_t cmd) {
     painter_driver_t *                   driver       = (painter_driver_t *)device;
     painter_comms_with_command_vtable_t *comms_vtable = (painter_comms_with_command_vtable_t *)driver->comms_vtable;
+    qp_comms_wait(device);
     comms_vtable->send_command(device, cmd);
 }
 
@@ -68,5 +103,6 @@ uint32_t qp_comms_command_databuf(painter_device_t device, uint8_t cmd, const vo
 void qp_comms_bulk_command_sequence(painter_device_t device, const uint8_t *sequence, size_t sequence_len) {
     painter_driver_t *                   driver       = (painter_driver_t *)device;
     painter_comms_with_command_vtable_t *comms_vtable = (painter_comms_with_command_vtable_t *)driver->comms_vtable;
+    qp_comms_wait(device);
     comms_vtable->bulk_command_sequence(device, sequence, sequence_len);
 }
@@ -10,7 +10,19 @@
 // Quantum Painter utility functions
 
 // Global variable used for native pixel data streaming.
+#if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+extern uint8_t* qp_internal_global_pixdata_buffer;
+#else
 extern uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+#endif
+
+// Switches the global pixdata buffer to the alternate buffer if double-buffering, so the next block of pixel data can be
+// prepared while the previous one is still being transmitted. Anything filling the global pixdata buffer needs to
+// invoke this after each pixdata call, and must not hold on to the previous buffer address.
+void qp_internal_swap_pixdata_buffer(void);
+
+// Returns true if the supplied data is one of the pixdata buffers, and may be transmitted asynchronously
+bool qp_internal_is_pixdata_buffer(const void* data);
 
 // Check if the supplied bpp is capable of being rendered
 bool qp_internal_bpp_capable(uint8_t bits_per_pixel);
@@ -139,6 +139,7 @@ bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg
         if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->pixel_write_pos)) {
             return false;
         }
+        qp_internal_swap_pixdata_buffer();
         state->pixel_write_pos = 0;
     }
 
@@ -159,13 +160,210 @@ bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg) {
         if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->byte_write_pos * 8 / driver->native_bits_per_pixel)) {
             return false;
         }
+        qp_internal_swap_pixdata_buffer();
         state->byte_write_pos = 0;
     }
 
     return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Bulk pull of bytes from memory streams, push of pixels
+
+// Number of pixels decoded per iteration of the bulk pipeline, must be a multiple of 8
+#ifndef QUANTUM_PAINTER_DECODE_CHUNK_PIXELS
+#    define QUANTUM_PAINTER_DECODE_CHUNK_PIXELS 64
+#endif
+
+#if (QUANTUM_PAINTER_DECODE_CHUNK_PIXELS % 8) != 0
+#    error QUANTUM_PAINTER_DECODE_CHUNK_PIXELS must be a multiple of 8
+#endif
+
+// The bulk pipeline only handles the built-in decoders, reading directly from the backing buffer of a memory stream
+static bool qp_internal_bulk_capable(qp_internal_byte_input_callback input_callback, void* input_arg) {
+    if (input_callback != qp_drawimage_byte_uncompressed_decoder && input_callback != qp_drawimage_byte_rle_decoder) {
+        return false;
+    }
+    qp_internal_byte_input_state_t* state = (qp_internal_byte_input_state_t*)input_arg;
+    return qp_stream_is_memory(state->src_stream);
+}
+
+// Copies out the requested number of decoded bytes, leaving the input state exactly as the equivalent number of calls to
+// the byte-at-a-time decoders would have -- font rendering continues to use the same input state across glyphs.
+static bool qp_internal_bulk_read(qp_internal_byte_input_state_t* state, bool rle, uint8_t* output, uint32_t count) {
+    qp_memory_stream_t* s = (qp_memory_stream_t*)state->src_stream;
+
+    if (!rle) {
+        int32_t available = s->length - s->position;
+        if (s->position < 0 || available < 0 || (uint32_t)available < count) {
+            s->is_eof = true;
+            return false;
+        }
+        memcpy(output, &s->buffer[s->position], count);
+        s->position += count;
+        state->curr = output[count - 1];
+        return true;
+    }
+
+    while (count > 0) {
+        // Parse the marker byte, along with the first byte of the run
+        if (state->rle.mode == MARKER_BYTE) {
+            if (s->position < 0 || s->length - s->position < 2) {
+                s->is_eof = true;
+                return false;
+            }
+            uint8_t c = s->buffer[s->position++];
+            if (c >= 128) {
+                state->rle.mode   = NON_REPEATING_RUN;
+                state->rle.remain = c - 127;
+            } else {
+                state->rle.mode   = REPEATING_RUN;
+                state->rle.remain = c;
+            }
+            state->curr = s->buffer[s->position++];
+
+            // Zero-length runs are never emitted by the encoder
+            if (state->rle.remain == 0) {
+                return false;
+            }
+        }
+
+        uint8_t n = (uint8_t)QP_MIN(count, state->rle.remain);
+        if (state->rle.mode == REPEATING_RUN) {
+            memset(output, state->curr, n);
+        } else {
+            // The first byte of the run has already been queued up, and the one following this chunk needs to be
+            uint8_t needed = n - 1 + (state->rle.remain > n ? 1 : 0);
+            if (s->length - s->position < needed) {
+                s->is_eof = true;
+                return false;
+            }
+            output[0] = state->curr;
+            memcpy(&output[1], &s->buffer[s->position], n - 1);
+            s->position += n - 1;
+            state->curr = (state->rle.remain > n) ? s->buffer[s->position++] : output[n - 1];
+        }
+
+        state->rle.remain -= n;
+        if (state->rle.remain == 0) {
+            state->rle.mode = MARKER_BYTE;
+        }
+
+        output += n;
+        count -= n;
+    }
+
+    return true;
+}
+
+// Unpacks each byte into its palette indices, least significant bits first
+static inline void qp_internal_bulk_unpack(const uint8_t* input, uint32_t byte_count, uint8_t bits_per_pixel, uint8_t* indices) {
+    switch (bits_per_pixel) {
+        case 1:
+            for (uint32_t i = 0; i < byte_count; ++i) {
+                uint8_t b  = input[i];
+                indices[0] = b & 0x01;
+                indices[1] = (b >> 1) & 0x01;
+                indices[2] = (b >> 2) & 0x01;
+                indices[3] = (b >> 3) & 0x01;
+                indices[4] = (b >> 4) & 0x01;
+                indices[5] = (b >> 5) & 0x01;
+                indices[6] = (b >> 6) & 0x01;
+                indices[7] = b >> 7;
+                indices += 8;
+            }
+            break;
+        case 2:
+            for (uint32_t i = 0; i < byte_count; ++i) {
+                uint8_t b  = input[i];
+                indices[0] = b & 0x03;
+                indices[1] = (b >> 2) & 0x03;
+                indices[2] = (b >> 4) & 0x03;
+                indices[3] = b >> 6;
+                indices += 4;
+            }
+            break;
+        case 4:
+            for (uint32_t i = 0; i < byte_count; ++i) {
+                uint8_t b  = input[i];
+                indices[0] = b & 0x0F;
+                indices[1] = b >> 4;
+                indices += 2;
+            }
+            break;
+    }
+}
+
+static bool qp_internal_bulk_decode_palette(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_state_t* input_state, bool rle, qp_internal_pixel_output_state_t* output_state) {
+    painter_driver_t* driver           = (painter_driver_t*)device;
+    const uint8_t     pixels_per_byte  = 8 / bits_per_pixel;
+    uint32_t          remaining_pixels = pixel_count;
+    uint8_t           packed[QUANTUM_PAINTER_DECODE_CHUNK_PIXELS];
+    uint8_t           indices[QUANTUM_PAINTER_DECODE_CHUNK_PIXELS];
+
+    while (remaining_pixels > 0) {
+        // Only the final chunk may end part-way through a byte, matching qp_internal_decode_palette
+        uint32_t loop_pixels = QP_MIN(remaining_pixels, QUANTUM_PAINTER_DECODE_CHUNK_PIXELS);
+        uint32_t loop_bytes  = (loop_pixels + pixels_per_byte - 1) / pixels_per_byte;
+
+        if (bits_per_pixel == 8) {
+            if (!qp_internal_bulk_read(input_state, rle, indices, loop_bytes)) {
+                return false;
+            }
+        } else {
+            if (!qp_internal_bulk_read(input_state, rle, packed, loop_bytes)) {
+                return false;
+            }
+            qp_internal_bulk_unpack(packed, loop_bytes, bits_per_pixel, indices);
+        }
+
+        // Append as many pixels as fit in the pixdata buffer, sending it out whenever it fills up
+        uint32_t done = 0;
+        while (done < loop_pixels) {
+            uint32_t n = QP_MIN(loop_pixels - done, output_state->max_pixels - output_state->pixel_write_pos);
+            if (!driver->driver_vtable->append_pixels(device, qp_internal_global_pixdata_buffer, qp_internal_global_pixel_lookup_table, output_state->pixel_write_pos, n, &indices[done])) {
+                return false;
+            }
+            output_state->pixel_write_pos += n;
+            done += n;
+
+            if (output_state->pixel_write_pos == output_state->max_pixels) {
+                if (!driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state->pixel_write_pos)) {
+                    return false;
+                }
+                qp_internal_swap_pixdata_buffer();
+                output_state->pixel_write_pos = 0;
+            }
+        }
+
+        remaining_pixels -= loop_pixels;
+    }
+
+    return true;
+}
+
+static bool qp_internal_bulk_send_bytes(painter_device_t device, uint32_t byte_count, qp_internal_byte_input_state_t* input_state, bool rle, qp_internal_byte_output_state_t* output_state) {
+    uint32_t remaining_bytes = byte_count;
+    uint8_t  chunk[QUANTUM_PAINTER_DECODE_CHUNK_PIXELS];
+
+    while (remaining_bytes > 0) {
+        uint32_t loop_bytes = QP_MIN(remaining_bytes, sizeof(chunk));
+        if (!qp_internal_bulk_read(input_state, rle, chunk, loop_bytes)) {
+            return false;
+        }
+        for (uint32_t i = 0; i < loop_bytes; ++i) {
+            if (!qp_internal_byte_appender(chunk[i], output_state)) {
+                return false;
+            }
+        }
+        remaining_bytes -= loop_bytes;
+    }
+
+    return true;
+}
+
 // Helper shared between image and font rendering -- uses either (qp_internal_decode_palette + qp_internal_pixel_appender) or (qp_internal_send_bytes) to send data data to the display based on the asset's native-ness
+// Memory-backed assets skip the per-byte callbacks and are decoded in bulk instead
 bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, void* input_state) {
     painter_driver_t* driver = (painter_driver_t*)device;
 
@@ -177,10 +375,15 @@ bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_c
         qp_internal_pixel_output_state_t output_state = {.device = device, .pixel_write_pos = 0, .max_pixels = qp_internal_num_pixels_in_buffer(device)};
 
         // Decode the pixel data and stream to the display
-        ret = qp_internal_decode_palette(device, pixel_count, bpp, input_callback, input_state, qp_internal_global_pixel_lookup_table, qp_internal_pixel_appender, &output_state);
+        if (qp_internal_bulk_capable(input_callback, input_state)) {
+            ret = qp_internal_bulk_decode_palette(device, pixel_count, bpp, (qp_internal_byte_input_state_t*)input_state, input_callback == qp_drawimage_byte_rle_decoder, &output_state);
+        } else {
+            ret = qp_internal_decode_palette(device, pixel_count, bpp, input_callback, input_state, qp_internal_global_pixel_lookup_table, qp_internal_pixel_appender, &output_state);
+        }
         // Any leftovers need transmission as well.
         if (ret && output_state.pixel_write_pos > 0) {
             ret &= driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.pixel_write_pos);
+            qp_internal_swap_pixdata_buffer();
         }
     }
 
@@ -194,10 +397,15 @@ bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_c
 
         // Stream the raw pixel data to the display
         uint32_t byte_count = pixel_count * bpp / 8;
-        ret                 = qp_internal_send_bytes(device, byte_count, input_callback, input_state, qp_internal_byte_appender, &output_state);
+        if (qp_internal_bulk_capable(input_callback, input_state)) {
+            ret = qp_internal_bulk_send_bytes(device, byte_count, (qp_internal_byte_input_state_t*)input_state, input_callback == qp_drawimage_byte_rle_decoder, &output_state);
+        } else {
+            ret = qp_internal_send_bytes(device, byte_count, input_callback, input_state, qp_internal_byte_appender, &output_state);
+        }
         // Any leftovers need transmission as well.
         if (ret && output_state.byte_write_pos > 0) {
             ret &= driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.byte_write_pos * 8 / driver->native_bits_per_pixel);
+            qp_internal_swap_pixdata_buffer();
         }
     }
 
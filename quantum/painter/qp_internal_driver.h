@@ -38,12 +38,15 @@ typedef bool (*painter_driver_comms_init_func)(painter_device_t device);
 typedef bool (*painter_driver_comms_start_func)(painter_device_t device);
 typedef void (*painter_driver_comms_stop_func)(painter_device_t device);
 typedef uint32_t (*painter_driver_comms_send_func)(painter_device_t device, const void *data, uint32_t byte_count);
+typedef void (*painter_driver_comms_complete_func)(painter_device_t device);
+typedef bool (*painter_driver_comms_send_async_func)(painter_device_t device, const void *data, uint32_t byte_count, painter_driver_comms_complete_func complete);
 
 typedef struct painter_comms_vtable_t {
-    painter_driver_comms_init_func  comms_init;
-    painter_driver_comms_start_func comms_start;
-    painter_driver_comms_stop_func  comms_stop;
-    painter_driver_comms_send_func  comms_send;
+    painter_driver_comms_init_func       comms_init;
+    painter_driver_comms_start_func      comms_start;
+    painter_driver_comms_stop_func       comms_stop;
+    painter_driver_comms_send_func       comms_send;
+    painter_driver_comms_send_async_func comms_send_async; // optional -- returns false if the transfer could not be started, otherwise invokes `complete` once the data is no longer needed
 } painter_comms_vtable_t;
 
 typedef void (*painter_driver_comms_send_command_func)(painter_device_t device, uint8_t cmd);
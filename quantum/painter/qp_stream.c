@@ -119,6 +119,10 @@ qp_memory_stream_t qp_make_memory_stream(void *buffer, int32_t length) {
     return stream;
 }
 
+bool qp_stream_is_memory(qp_stream_t *stream) {
+    return stream->get == mem_get;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // FILE streams
 
@@ -70,6 +70,9 @@ typedef struct qp_memory_stream_t {
 
 qp_memory_stream_t qp_make_memory_stream(void *buffer, int32_t length);
 
+// Returns true if the stream is a memory stream, allowing its buffer to be accessed directly
+bool qp_stream_is_memory(qp_stream_t *stream);
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // FILE streams
 
@@ -286,6 +286,96 @@ static inline void _find_key_index_and_count(const uint16_t *keys, uint16_t keyc
     }
 }
 
+#ifdef COMBO_KEYCODE_INDEX
+/* Reverse index from keycode to the combos using it, sorted by keycode and
+ * then by combo index so candidates are visited in the same order as a
+ * linear scan over all combos. */
+typedef struct {
+    uint16_t keycode;
+    uint16_t combo_index;
+} combo_keycode_index_entry_t;
+
+typedef enum { COMBO_KEYCODE_INDEX_STALE, COMBO_KEYCODE_INDEX_VALID, COMBO_KEYCODE_INDEX_OVERFLOW } combo_keycode_index_state_t;
+
+static combo_keycode_index_entry_t combo_keycode_index[COMBO_KEYCODE_INDEX_SIZE];
+static uint16_t                    combo_keycode_index_size  = 0;
+static combo_keycode_index_state_t combo_keycode_index_state = COMBO_KEYCODE_INDEX_STALE;
+
+void combo_keycode_index_rebuild(void) {
+    combo_keycode_index_size  = 0;
+    combo_keycode_index_state = COMBO_KEYCODE_INDEX_VALID;
+
+    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+        combo_t *combo     = combo_get(idx);
+        uint16_t key_first = combo_keycode_index_size;
+        uint16_t key;
+
+        for (uint8_t key_i = 0; (key = pgm_read_word(&combo->keys[key_i])) != COMBO_END; ++key_i) {
+            bool duplicate = false;
+            for (uint16_t i = key_first; i < combo_keycode_index_size; ++i) {
+                if (combo_keycode_index[i].keycode == key) {
+                    duplicate = true;
+                    break;
+                }
+            }
+            if (duplicate) {
+                continue;
+            }
+            if (combo_keycode_index_size >= COMBO_KEYCODE_INDEX_SIZE) {
+                combo_keycode_index_state = COMBO_KEYCODE_INDEX_OVERFLOW;
+                return;
+            }
+            combo_keycode_index[combo_keycode_index_size++] = (combo_keycode_index_entry_t){
+                .keycode     = key,
+                .combo_index = idx,
+            };
+        }
+    }
+
+    /* Stable insertion sort by keycode, entries were appended in combo order. */
+    for (uint16_t i = 1; i < combo_keycode_index_size; ++i) {
+        combo_keycode_index_entry_t entry = combo_keycode_index[i];
+        uint16_t                    j     = i;
+        while (j > 0 && combo_keycode_index[j - 1].keycode > entry.keycode) {
+            combo_keycode_index[j] = combo_keycode_index[j - 1];
+            --j;
+        }
+        combo_keycode_index[j] = entry;
+    }
+}
+
+bool combo_keycode_index_find(uint16_t keycode, uint16_t *position, uint16_t *count) {
+    if (combo_keycode_index_state == COMBO_KEYCODE_INDEX_STALE) {
+        combo_keycode_index_rebuild();
+    }
+    if (combo_keycode_index_state != COMBO_KEYCODE_INDEX_VALID) {
+        return false;
+    }
+
+    /* lower bound of keycode */
+    uint16_t low = 0, high = combo_keycode_index_size;
+    while (low < high) {
+        uint16_t mid = low + (high - low) / 2;
+        if (combo_keycode_index[mid].keycode < keycode) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    *position = low;
+    *count    = 0;
+    while (low + *count < combo_keycode_index_size && combo_keycode_index[low + *count].keycode == keycode) {
+        (*count)++;
+    }
+    return true;
+}
+
+uint16_t combo_keycode_index_get(uint16_t position) {
+    return combo_keycode_index[position].combo_index;
+}
+#endif
+
 void drop_combo_from_buffer(uint16_t combo_index) {
     /* Mark a combo as processed from the buffer. If the buffer is in the
      * beginning of the buffer, drop it.  */
@@ -581,10 +671,23 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     }
 #endif
 
-    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
-        combo_t *combo = combo_get(idx);
-        is_combo_key |= process_single_combo(combo, keycode, record, idx);
-        no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+#ifdef COMBO_KEYCODE_INDEX
+    uint16_t position, count;
+    if (combo_keycode_index_find(keycode, &position, &count)) {
+        /* Only combos containing the keycode can change state. */
+        for (uint16_t i = 0; i < count; ++i) {
+            uint16_t idx   = combo_keycode_index_get(position + i);
+            combo_t *combo = combo_get(idx);
+            is_combo_key |= process_single_combo(combo, keycode, record, idx);
+        }
+    } else
+#endif
+    {
+        for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+            combo_t *combo = combo_get(idx);
+            is_combo_key |= process_single_combo(combo, keycode, record, idx);
+            no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+        }
     }
 
     if (record->event.pressed && is_combo_key) {
@@ -62,6 +62,12 @@ typedef struct combo_t {
 #define COMBO_ACTION(ck) \
     { .keys = &(ck)[0] }
 
+#ifdef COMBO_KEYCODE_INDEX
+#    ifndef COMBO_KEYCODE_INDEX_SIZE
+#        define COMBO_KEYCODE_INDEX_SIZE 256
+#    endif
+#endif
+
 #define COMBO_END 0
 #ifndef COMBO_TERM
 #    define COMBO_TERM 50
@@ -81,3 +87,14 @@ void combo_enable(void);
 void combo_disable(void);
 void combo_toggle(void);
 bool is_combo_enabled(void);
+
+#ifdef COMBO_KEYCODE_INDEX
+/* Rebuilds the keycode to combo index, required whenever the result of
+ * combo_count()/combo_get() changes at runtime. */
+void combo_keycode_index_rebuild(void);
+/* Finds the combos containing keycode. On success, position and count
+ * describe the matching range for combo_keycode_index_get(). Returns false
+ * if the index could not hold all combo keys and a linear scan is needed. */
+bool     combo_keycode_index_find(uint16_t keycode, uint16_t *position, uint16_t *count);
+uint16_t combo_keycode_index_get(uint16_t position);
+#endif
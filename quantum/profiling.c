@@ -0,0 +1,167 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "profiling.h"
+#include <string.h>
+#include "bitwise.h"
+#include "print.h"
+#include "util.h"
+
+static profile_zone_stats_t profile_zones[PROFILE_ZONE_COUNT];
+
+// clang-format off
+static const char *const profile_zone_names[PROFILE_ZONE_COUNT] = {
+    [PROFILE_ZONE_KEYBOARD_TASK]          = "keyboard_task",
+    [PROFILE_ZONE_MATRIX_TASK]            = "matrix_task",
+    [PROFILE_ZONE_QUANTUM_TASK]           = "quantum_task",
+    [PROFILE_ZONE_PROCESS_RECORD_QUANTUM] = "process_record_quantum",
+    [PROFILE_ZONE_SPLIT_WATCHDOG_TASK]    = "split_watchdog_task",
+    [PROFILE_ZONE_RGBLIGHT_TASK]          = "rgblight_task",
+    [PROFILE_ZONE_LED_MATRIX_TASK]        = "led_matrix_task",
+    [PROFILE_ZONE_RGB_MATRIX_TASK]        = "rgb_matrix_task",
+    [PROFILE_ZONE_BACKLIGHT_TASK]         = "backlight_task",
+    [PROFILE_ZONE_ENCODER_TASK]           = "encoder_task",
+    [PROFILE_ZONE_POINTING_DEVICE_TASK]   = "pointing_device_task",
+    [PROFILE_ZONE_OLED_TASK]              = "oled_task",
+    [PROFILE_ZONE_ST7565_TASK]            = "st7565_task",
+    [PROFILE_ZONE_MOUSEKEY_TASK]          = "mousekey_task",
+    [PROFILE_ZONE_PS2_MOUSE_TASK]         = "ps2_mouse_task",
+    [PROFILE_ZONE_MIDI_TASK]              = "midi_task",
+    [PROFILE_ZONE_JOYSTICK_TASK]          = "joystick_task",
+    [PROFILE_ZONE_BATTERY_TASK]           = "battery_task",
+    [PROFILE_ZONE_BLUETOOTH_TASK]         = "bluetooth_task",
+    [PROFILE_ZONE_HAPTIC_TASK]            = "haptic_task",
+    [PROFILE_ZONE_LED_TASK]               = "led_task",
+    [PROFILE_ZONE_OS_DETECTION_TASK]      = "os_detection_task",
+    [PROFILE_ZONE_EEPROM_DRIVER_TASK]     = "eeprom_driver_task",
+    [PROFILE_ZONE_MUSIC_TASK]             = "music_task",
+    [PROFILE_ZONE_KEY_OVERRIDE_TASK]      = "key_override_task",
+    [PROFILE_ZONE_SEQUENCER_TASK]         = "sequencer_task",
+    [PROFILE_ZONE_TAP_DANCE_TASK]         = "tap_dance_task",
+    [PROFILE_ZONE_COMBO_TASK]             = "combo_task",
+    [PROFILE_ZONE_LEADER_TASK]            = "leader_task",
+    [PROFILE_ZONE_DECAY_WPM]              = "decay_wpm",
+    [PROFILE_ZONE_DIP_SWITCH_TASK]        = "dip_switch_task",
+    [PROFILE_ZONE_AUTOSHIFT_MATRIX_SCAN]  = "autoshift_matrix_scan",
+    [PROFILE_ZONE_CAPS_WORD_TASK]         = "caps_word_task",
+    [PROFILE_ZONE_SECURE_TASK]            = "secure_task",
+    [PROFILE_ZONE_LAYER_LOCK_TASK]        = "layer_lock_task",
+    [PROFILE_ZONE_DYNAMIC_KEYMAP_TASK]    = "dynamic_keymap_task",
+    [PROFILE_ZONE_USER_0]                 = "user_0",
+    [PROFILE_ZONE_USER_1]                 = "user_1",
+    [PROFILE_ZONE_USER_2]                 = "user_2",
+    [PROFILE_ZONE_USER_3]                 = "user_3",
+};
+// clang-format on
+
+void profiling_record(profile_zone_t zone, uint32_t duration) {
+    if (zone >= PROFILE_ZONE_COUNT) {
+        return;
+    }
+
+    profile_zone_stats_t *stats = &profile_zones[zone];
+    if (stats->count == 0 || duration < stats->min) {
+        stats->min = duration;
+    }
+    if (duration > stats->max) {
+        stats->max = duration;
+    }
+    stats->total += duration;
+    stats->count++;
+
+    uint8_t bucket = duration ? biton32(duration) / 2 : 0;
+    if (bucket >= PROFILING_HISTOGRAM_BUCKETS) {
+        bucket = PROFILING_HISTOGRAM_BUCKETS - 1;
+    }
+    if (stats->histogram[bucket] < UINT16_MAX) {
+        stats->histogram[bucket]++;
+    }
+}
+
+const profile_zone_stats_t *profiling_get_stats(profile_zone_t zone) {
+    if (zone >= PROFILE_ZONE_COUNT) {
+        return NULL;
+    }
+    return &profile_zones[zone];
+}
+
+const char *profiling_zone_name(profile_zone_t zone) {
+    if (zone >= PROFILE_ZONE_COUNT) {
+        return NULL;
+    }
+    return profile_zone_names[zone];
+}
+
+void profiling_reset(void) {
+    memset(profile_zones, 0, sizeof(profile_zones));
+}
+
+static uint32_t profiling_mean(const profile_zone_stats_t *stats) {
+    return stats->count ? (uint32_t)(stats->total / stats->count) : 0;
+}
+
+void profiling_print(void) {
+    for (uint8_t zone = 0; zone < PROFILE_ZONE_COUNT; zone++) {
+        const profile_zone_stats_t *stats = &profile_zones[zone];
+        if (stats->count == 0) {
+            continue;
+        }
+
+        xprintf("%s: count=%lu min=%lu max=%lu mean=%lu hist=", profile_zone_names[zone], (unsigned long)stats->count, (unsigned long)stats->min, (unsigned long)stats->max, (unsigned long)profiling_mean(stats));
+        for (uint8_t bucket = 0; bucket < PROFILING_HISTOGRAM_BUCKETS; bucket++) {
+            xprintf(bucket ? ",%u" : "%u", stats->histogram[bucket]);
+        }
+        xprintf("\n");
+    }
+}
+
+static void profiling_write_u32(uint8_t *data, uint32_t value) {
+    data[0] = value & 0xFF;
+    data[1] = (value >> 8) & 0xFF;
+    data[2] = (value >> 16) & 0xFF;
+    data[3] = (value >> 24) & 0xFF;
+}
+
+bool profiling_raw_hid_receive(uint8_t *data, uint8_t length) {
+    if (length < 3 || data[0] != PROFILING_RAW_HID_ID) {
+        return false;
+    }
+
+    const uint8_t zone = data[2];
+    switch (data[1]) {
+        case PROFILING_RAW_HID_GET_ZONE_COUNT:
+            data[2] = PROFILE_ZONE_COUNT;
+            return true;
+
+        case PROFILING_RAW_HID_GET_ZONE_STATS:
+            if (zone < PROFILE_ZONE_COUNT && length >= 19) {
+                const profile_zone_stats_t *stats = &profile_zones[zone];
+                profiling_write_u32(&data[3], stats->count);
+                profiling_write_u32(&data[7], stats->min);
+                profiling_write_u32(&data[11], stats->max);
+                profiling_write_u32(&data[15], profiling_mean(stats));
+                return true;
+            }
+            break;
+
+        case PROFILING_RAW_HID_GET_HISTOGRAM:
+            if (zone < PROFILE_ZONE_COUNT && length >= 4) {
+                const uint8_t buckets = MIN(PROFILING_HISTOGRAM_BUCKETS, (length - 4) / 2);
+                data[3]               = buckets;
+                for (uint8_t bucket = 0; bucket < buckets; bucket++) {
+                    data[4 + bucket * 2] = profile_zones[zone].histogram[bucket] & 0xFF;
+                    data[5 + bucket * 2] = profile_zones[zone].histogram[bucket] >> 8;
+                }
+                return true;
+            }
+            break;
+
+        case PROFILING_RAW_HID_RESET:
+            profiling_reset();
+            return true;
+    }
+
+    // unknown command or zone
+    data[1] = 0xFF;
+    return true;
+}
@@ -0,0 +1,148 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+    Zone based profiling, enabled with `PROFILING_ENABLE = yes`.
+
+    Each zone keeps call count, min/max/mean duration and a log4 histogram in
+    a fixed RAM table. Durations are in platform timestamp ticks, see
+    profiling_timestamp().
+
+    Usage example:
+
+        #include "profiling.h"
+
+        // void calls
+        PROFILE_ZONE_CALL(PROFILE_ZONE_USER_0, my_task());
+
+        // anything else
+        PROFILE_ZONE_BEGIN(PROFILE_ZONE_USER_1);
+        bool changed = my_other_task();
+        PROFILE_ZONE_END(PROFILE_ZONE_USER_1);
+*/
+
+typedef enum {
+    PROFILE_ZONE_KEYBOARD_TASK,
+    PROFILE_ZONE_MATRIX_TASK,
+    PROFILE_ZONE_QUANTUM_TASK,
+    PROFILE_ZONE_PROCESS_RECORD_QUANTUM,
+    // keyboard_task()
+    PROFILE_ZONE_SPLIT_WATCHDOG_TASK,
+    PROFILE_ZONE_RGBLIGHT_TASK,
+    PROFILE_ZONE_LED_MATRIX_TASK,
+    PROFILE_ZONE_RGB_MATRIX_TASK,
+    PROFILE_ZONE_BACKLIGHT_TASK,
+    PROFILE_ZONE_ENCODER_TASK,
+    PROFILE_ZONE_POINTING_DEVICE_TASK,
+    PROFILE_ZONE_OLED_TASK,
+    PROFILE_ZONE_ST7565_TASK,
+    PROFILE_ZONE_MOUSEKEY_TASK,
+    PROFILE_ZONE_PS2_MOUSE_TASK,
+    PROFILE_ZONE_MIDI_TASK,
+    PROFILE_ZONE_JOYSTICK_TASK,
+    PROFILE_ZONE_BATTERY_TASK,
+    PROFILE_ZONE_BLUETOOTH_TASK,
+    PROFILE_ZONE_HAPTIC_TASK,
+    PROFILE_ZONE_LED_TASK,
+    PROFILE_ZONE_OS_DETECTION_TASK,
+    PROFILE_ZONE_EEPROM_DRIVER_TASK,
+    // quantum_task()
+    PROFILE_ZONE_MUSIC_TASK,
+    PROFILE_ZONE_KEY_OVERRIDE_TASK,
+    PROFILE_ZONE_SEQUENCER_TASK,
+    PROFILE_ZONE_TAP_DANCE_TASK,
+    PROFILE_ZONE_COMBO_TASK,
+    PROFILE_ZONE_LEADER_TASK,
+    PROFILE_ZONE_DECAY_WPM,
+    PROFILE_ZONE_DIP_SWITCH_TASK,
+    PROFILE_ZONE_AUTOSHIFT_MATRIX_SCAN,
+    PROFILE_ZONE_CAPS_WORD_TASK,
+    PROFILE_ZONE_SECURE_TASK,
+    PROFILE_ZONE_LAYER_LOCK_TASK,
+    PROFILE_ZONE_DYNAMIC_KEYMAP_TASK,
+    // free for keyboard and user code
+    PROFILE_ZONE_USER_0,
+    PROFILE_ZONE_USER_1,
+    PROFILE_ZONE_USER_2,
+    PROFILE_ZONE_USER_3,
+    PROFILE_ZONE_COUNT,
+} profile_zone_t;
+
+#ifndef PROFILING_HISTOGRAM_BUCKETS
+#    define PROFILING_HISTOGRAM_BUCKETS 12
+#endif
+
+typedef struct {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+    // bucket n counts durations in [4^n, 4^(n+1)), the last bucket also counts anything longer
+    uint16_t histogram[PROFILING_HISTOGRAM_BUCKETS];
+} profile_zone_stats_t;
+
+#ifndef PROFILING_RAW_HID_ID
+#    define PROFILING_RAW_HID_ID 0xFD
+#endif
+
+enum profiling_raw_hid_command {
+    PROFILING_RAW_HID_GET_ZONE_COUNT = 0x01,
+    PROFILING_RAW_HID_GET_ZONE_STATS = 0x02,
+    PROFILING_RAW_HID_GET_HISTOGRAM  = 0x03,
+    PROFILING_RAW_HID_RESET          = 0x04,
+};
+
+/**
+ * @brief Reads the platform timestamp used to time zones. Cycles where the
+ * MCU has a cycle counter, the finest available timer ticks otherwise, and
+ * nanoseconds on the test platform.
+ */
+uint32_t profiling_timestamp(void);
+
+void profiling_record(profile_zone_t zone, uint32_t duration);
+
+const profile_zone_stats_t *profiling_get_stats(profile_zone_t zone);
+
+const char *profiling_zone_name(profile_zone_t zone);
+
+void profiling_reset(void);
+
+/**
+ * @brief Prints the statistics of every zone that recorded calls over the
+ * console.
+ */
+void profiling_print(void);
+
+/**
+ * @brief Handles profiling requests received over raw HID, to be called from
+ * raw_hid_receive() or raw_hid_receive_kb().
+ *
+ * data[0] is PROFILING_RAW_HID_ID, data[1] a profiling_raw_hid_command and
+ * data[2] the zone where applicable. The reply is written back to data.
+ *
+ * @return true The request was a profiling request and data holds the reply
+ */
+bool profiling_raw_hid_receive(uint8_t *data, uint8_t length);
+
+#ifdef PROFILING_ENABLE
+#    define PROFILE_ZONE_BEGIN(zone) const uint32_t profile_zone_start_##zone = profiling_timestamp()
+#    define PROFILE_ZONE_END(zone) profiling_record((zone), profiling_timestamp() - profile_zone_start_##zone)
+#else
+#    define PROFILE_ZONE_BEGIN(zone) \
+        do {                         \
+        } while (0)
+#    define PROFILE_ZONE_END(zone) \
+        do {                       \
+        } while (0)
+#endif
+
+#define PROFILE_ZONE_CALL(zone, call) \
+    do {                              \
+        PROFILE_ZONE_BEGIN(zone);     \
+        call;                         \
+        PROFILE_ZONE_END(zone);       \
+    } while (0)
@@ -34,10 +34,48 @@ const led_point_t k_rgb_matrix_center = {112, 32};
 const led_point_t k_rgb_matrix_center = RGB_MATRIX_CENTER;
 #endif
 
+#ifndef RGB_MATRIX_HSV_BATCH_SIZE
+#    define RGB_MATRIX_HSV_BATCH_SIZE 16
+#endif
+
 __attribute__((weak)) rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv) {
     return hsv_to_rgb(hsv);
 }
 
+__attribute__((weak)) void rgb_matrix_hsv_to_rgb_batch(const hsv_t *hsv, rgb_t *rgb, uint8_t count) {
+#ifdef RGB_MATRIX_HSV_BATCH_FAST
+    // Bypasses rgb_matrix_hsv_to_rgb(), any override of it needs a matching override of this
+    hsv_to_rgb_batch(hsv, rgb, count);
+#else
+    for (uint8_t i = 0; i < count; i++) {
+        rgb[i] = rgb_matrix_hsv_to_rgb(hsv[i]);
+    }
+#endif
+}
+
+// Colors staged by the effect runners, converted together once the batch is full
+static uint8_t rgb_matrix_batch_count = 0;
+static uint8_t rgb_matrix_batch_index[RGB_MATRIX_HSV_BATCH_SIZE];
+static hsv_t   rgb_matrix_batch_hsv[RGB_MATRIX_HSV_BATCH_SIZE];
+
+static void rgb_matrix_batch_flush(void) {
+    rgb_t rgb[RGB_MATRIX_HSV_BATCH_SIZE];
+
+    rgb_matrix_hsv_to_rgb_batch(rgb_matrix_batch_hsv, rgb, rgb_matrix_batch_count);
+    for (uint8_t i = 0; i < rgb_matrix_batch_count; i++) {
+        rgb_matrix_set_color(rgb_matrix_batch_index[i], rgb[i].r, rgb[i].g, rgb[i].b);
+    }
+    rgb_matrix_batch_count = 0;
+}
+
+static void rgb_matrix_batch_set_hsv(uint8_t index, hsv_t hsv) {
+    rgb_matrix_batch_index[rgb_matrix_batch_count] = index;
+    rgb_matrix_batch_hsv[rgb_matrix_batch_count]   = hsv;
+    if (++rgb_matrix_batch_count == RGB_MATRIX_HSV_BATCH_SIZE) {
+        rgb_matrix_batch_flush();
+    }
+}
+
 // Generic effect runners
 #include "rgb_matrix_runners.inc"
 
@@ -70,6 +108,7 @@ uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS] = {{0}};
 #endif // RGB_MATRIX_FRAMEBUFFER_EFFECTS
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 last_hit_t g_last_hit_tracker;
+uint8_t    g_last_hit_led[RGB_MATRIX_LED_COUNT];
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
 // internals
@@ -82,7 +121,13 @@ static rgb_task_states rgb_task_state    = SYNCING;
 // double buffers
 static uint32_t rgb_timer_buffer;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
+// ring of the remembered hits, oldest at last_hit_head
 static last_hit_t last_hit_buffer;
+static uint8_t    last_hit_head = 0;
+
+static inline uint8_t last_hit_next(uint8_t index) {
+    return index + 1 < LED_HITS_TO_REMEMBER ? index + 1 : 0;
+}
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
 // split rgb matrix
@@ -185,21 +230,21 @@ void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed) {
         led_count = rgb_matrix_map_row_column_to_led(row, col, led);
     }
 
-    if (last_hit_buffer.count + led_count > LED_HITS_TO_REMEMBER) {
-        memcpy(&last_hit_buffer.x[0], &last_hit_buffer.x[led_count], LED_HITS_TO_REMEMBER - led_count);
-        memcpy(&last_hit_buffer.y[0], &last_hit_buffer.y[led_count], LED_HITS_TO_REMEMBER - led_count);
-        memcpy(&last_hit_buffer.tick[0], &last_hit_buffer.tick[led_count], (LED_HITS_TO_REMEMBER - led_count) * 2); // 16 bit
-        memcpy(&last_hit_buffer.index[0], &last_hit_buffer.index[led_count], LED_HITS_TO_REMEMBER - led_count);
-        last_hit_buffer.count = LED_HITS_TO_REMEMBER - led_count;
-    }
-
     for (uint8_t i = 0; i < led_count; i++) {
-        uint8_t index                = last_hit_buffer.count;
+        uint16_t index = last_hit_head + last_hit_buffer.count;
+        if (index >= LED_HITS_TO_REMEMBER) {
+            index -= LED_HITS_TO_REMEMBER;
+        }
+        // a full ring overwrites the oldest hit
+        if (last_hit_buffer.count < LED_HITS_TO_REMEMBER) {
+            last_hit_buffer.count++;
+        } else {
+            last_hit_head = last_hit_next(last_hit_head);
+        }
         last_hit_buffer.x[index]     = g_led_config.point[led[i]].x;
         last_hit_buffer.y[index]     = g_led_config.point[led[i]].y;
         last_hit_buffer.index[index] = led[i];
         last_hit_buffer.tick[index]  = 0;
-        last_hit_buffer.count++;
     }
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
@@ -259,12 +304,16 @@ static void rgb_task_timers(void) {
     // Update double buffer last hit timers
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     uint8_t count = last_hit_buffer.count;
+    uint8_t index = last_hit_head;
     for (uint8_t i = 0; i < count; ++i) {
-        if (UINT16_MAX - deltaTime < last_hit_buffer.tick[i]) {
+        // hits age together, so the oldest ones are the first to expire
+        if (UINT16_MAX - deltaTime < last_hit_buffer.tick[index]) {
+            last_hit_head = last_hit_next(last_hit_head);
             last_hit_buffer.count--;
-            continue;
+        } else {
+            last_hit_buffer.tick[index] += deltaTime;
         }
-        last_hit_buffer.tick[i] += deltaTime;
+        index = last_hit_next(index);
     }
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 }
@@ -275,6 +324,27 @@ static void rgb_task_sync(void) {
     if (sync_timer_elapsed32(g_rgb_timer) >= RGB_MATRIX_LED_FLUSH_LIMIT) rgb_task_state = STARTING;
 }
 
+#ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
+// Unrolls the ring into g_last_hit_tracker, oldest hit first, and points g_last_hit_led at each LED's latest hit
+static void last_hit_update_tracker(void) {
+    for (uint8_t i = 0; i < g_last_hit_tracker.count; ++i) {
+        g_last_hit_led[g_last_hit_tracker.index[i]] = LAST_HIT_NONE;
+    }
+
+    uint8_t index            = last_hit_head;
+    g_last_hit_tracker.count = last_hit_buffer.count;
+    for (uint8_t i = 0; i < g_last_hit_tracker.count; ++i) {
+        g_last_hit_tracker.x[i]                      = last_hit_buffer.x[index];
+        g_last_hit_tracker.y[i]                      = last_hit_buffer.y[index];
+        g_last_hit_tracker.index[i]                  = last_hit_buffer.index[index];
+        g_last_hit_tracker.tick[i]                   = last_hit_buffer.tick[index];
+        g_last_hit_led[last_hit_buffer.index[index]] = i;
+
+        index = last_hit_next(index);
+    }
+}
+#endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+
 static void rgb_task_start(void) {
     // reset iter
     rgb_effect_params.iter = 0;
@@ -282,7 +352,7 @@ static void rgb_task_start(void) {
     // update double buffers
     g_rgb_timer = rgb_timer_buffer;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
-    g_last_hit_tracker = last_hit_buffer;
+    last_hit_update_tracker();
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
     // next task
@@ -482,7 +552,10 @@ void rgb_matrix_init(void) {
         g_last_hit_tracker.tick[i] = UINT16_MAX;
     }
 
+    memset(g_last_hit_led, LAST_HIT_NONE, sizeof(g_last_hit_led));
+
     last_hit_buffer.count = 0;
+    last_hit_head         = 0;
     for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
         last_hit_buffer.tick[i] = UINT16_MAX;
     }
@@ -156,6 +156,11 @@ int rgb_matrix_led_index(int index);
 void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue);
 void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue);
 
+// Converts effect colors, keyboards may override it to adjust them
+rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv);
+// Converts effect colors for the generic effect runners, through rgb_matrix_hsv_to_rgb() unless RGB_MATRIX_HSV_BATCH_FAST is defined
+void rgb_matrix_hsv_to_rgb_batch(const hsv_t *hsv, rgb_t *rgb, uint8_t count);
+
 void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed);
 
 void rgb_matrix_task(void);
@@ -282,6 +287,8 @@ extern uint32_t     g_rgb_timer;
 extern led_config_t g_led_config;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 extern last_hit_t g_last_hit_tracker;
+// Position of the most recent hit of each LED in g_last_hit_tracker, or LAST_HIT_NONE
+extern uint8_t g_last_hit_led[RGB_MATRIX_LED_COUNT];
 #endif
 #ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
 extern uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS];
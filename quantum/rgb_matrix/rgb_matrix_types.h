@@ -31,6 +31,12 @@
 #ifndef LED_HITS_TO_REMEMBER
 #    define LED_HITS_TO_REMEMBER 8
 #endif // LED_HITS_TO_REMEMBER
+#if LED_HITS_TO_REMEMBER > 255
+#    error LED_HITS_TO_REMEMBER must not exceed 255
+#endif
+
+// g_last_hit_led[] value of LEDs without a remembered hit
+#define LAST_HIT_NONE UINT8_MAX
 
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 typedef struct PACKED {
@@ -23,8 +23,15 @@ enum serial_transaction_id {
     I2C_EXECUTE_CALLBACK,
 #endif // USE_I2C
 
+#ifdef SPLIT_TRANSPORT_BATCH
+    CMD_BATCH_EXCHANGE,
+#endif // SPLIT_TRANSPORT_BATCH
+
     GET_SLAVE_MATRIX_CHECKSUM,
     GET_SLAVE_MATRIX_DATA,
+#ifdef SPLIT_MATRIX_EVENTS_ENABLE
+    GET_SLAVE_MATRIX_EVENTS,
+#endif // SPLIT_MATRIX_EVENTS_ENABLE
 
 #ifdef SPLIT_TRANSPORT_MIRROR
     PUT_MASTER_MATRIX,
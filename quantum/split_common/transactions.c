@@ -24,7 +24,7 @@
 #include "host.h"
 #include "action_util.h"
 #include "sync_timer.h"
-#include "wait.h"
+#include "util.h"
 #include "transactions.h"
 #include "transport.h"
 #include "transaction_id_define.h"
@@ -84,9 +84,63 @@
 #define trans_initiator2target_cb(cb) \
     { 0, 0, 0, 0, cb }
 
-#define transport_write(id, data, length) transport_execute_transaction(id, data, length, NULL, 0)
-#define transport_read(id, data, length) transport_execute_transaction(id, NULL, 0, data, length)
-#define transport_exec(id) transport_execute_transaction(id, NULL, 0, NULL, 0)
+#define trans_bidirectional_initializer_cb(initiator2target_member, target2initiator_member, cb) \
+    { sizeof_member(split_shared_memory_t, initiator2target_member), offsetof(split_shared_memory_t, initiator2target_member), sizeof_member(split_shared_memory_t, target2initiator_member), offsetof(split_shared_memory_t, target2initiator_member), cb }
+
+#ifndef SPLIT_TRANSACTION_RETRIES
+#    define SPLIT_TRANSACTION_RETRIES 2
+#endif // SPLIT_TRANSACTION_RETRIES
+
+#ifndef SPLIT_TRANSACTION_BACKOFF_MAX
+#    define SPLIT_TRANSACTION_BACKOFF_MAX 128
+#endif // SPLIT_TRANSACTION_BACKOFF_MAX
+
+// Link health score, each failed handler attempt adds LINK_ERROR_WEIGHT and each successful one drains 1
+#define LINK_ERROR_WEIGHT 8
+#define LINK_ERRORS_DEGRADED (2 * LINK_ERROR_WEIGHT)
+#define LINK_ERRORS_MAX (8 * LINK_ERROR_WEIGHT)
+
+#if defined(SPLIT_WATCHDOG_ENABLE)
+static split_transaction_stats_t transaction_stats[NUM_TOTAL_TRANSACTIONS];
+static uint16_t                  transaction_failing_since[NUM_TOTAL_TRANSACTIONS];
+
+static bool tracked_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+    split_transaction_stats_t *stats = &transaction_stats[id];
+    bool                       okay  = transport_execute_transaction(id, initiator2target_buf, initiator2target_length, target2initiator_buf, target2initiator_length);
+    if (okay) {
+        if (stats->failures) {
+            stats->latency     = timer_elapsed(transaction_failing_since[id]);
+            stats->latency_max = MAX(stats->latency_max, stats->latency);
+            stats->failures    = 0;
+        }
+    } else {
+        if (!stats->failures) {
+            transaction_failing_since[id] = timer_read();
+        }
+        if (stats->failures < UINT8_MAX) {
+            stats->failures++;
+        }
+        if (stats->errors < UINT16_MAX) {
+            stats->errors++;
+        }
+    }
+    return okay;
+}
+#    define execute_transaction(...) tracked_execute_transaction(__VA_ARGS__)
+#else // defined(SPLIT_WATCHDOG_ENABLE)
+#    define execute_transaction(...) transport_execute_transaction(__VA_ARGS__)
+#endif // defined(SPLIT_WATCHDOG_ENABLE)
+
+#ifdef SPLIT_TRANSPORT_BATCH
+static bool batch_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length);
+#    define transport_transaction(...) batch_execute_transaction(__VA_ARGS__)
+#else // SPLIT_TRANSPORT_BATCH
+#    define transport_transaction(...) execute_transaction(__VA_ARGS__)
+#endif // SPLIT_TRANSPORT_BATCH
+
+#define transport_write(id, data, length) transport_transaction(id, data, length, NULL, 0)
+#define transport_read(id, data, length) transport_transaction(id, NULL, 0, data, length)
+#define transport_exec(id) transport_transaction(id, NULL, 0, NULL, 0)
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 // Forward-declare the RPC callback handlers
@@ -97,25 +151,93 @@ void slave_rpc_exec_callback(uint8_t initiator2target_buffer_size, const void *i
 ////////////////////////////////////////////////////
 // Helpers
 
-static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[], const char *prefix, bool (*handler)(matrix_row_t master_matrix[], matrix_row_t slave_matrix[])) {
-    int num_retries = is_transport_connected() ? 10 : 1;
+#ifdef SPLIT_TRANSPORT_BATCH
+static bool batch_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
+#endif // SPLIT_TRANSPORT_BATCH
+
+static uint8_t link_errors = 0;
+
+bool split_transport_degraded(void) {
+    return link_errors >= LINK_ERRORS_DEGRADED;
+}
+
+// Retry state of a low priority handler
+typedef struct {
+    uint8_t  failures;
+    bool     waiting;
+    uint16_t retry_at;
+} transaction_schedule_t;
+
+/**
+ * @brief Runs a master handler without blocking the scan. Failed handlers are
+ * retried at once while the link is healthy, and only once per scan while it
+ * is degraded. Low priority handlers, those with a `schedule`, back off
+ * exponentially after failing and are deferred while the link is degraded,
+ * their failures don't fail the scan.
+ */
+static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[], const char *prefix, bool (*handler)(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]), transaction_schedule_t *schedule) {
+    const bool degraded = split_transport_degraded();
+    if (schedule) {
+        const uint16_t now = timer_read();
+        // Held back by its own failures, or by the link as long as it stays degraded
+        if (schedule->waiting && !timer_expired(now, schedule->retry_at) && (schedule->failures || degraded)) {
+            return true;
+        }
+        if (!schedule->waiting && degraded) {
+            // Trickle through once per backoff period until the link recovers
+            schedule->waiting  = true;
+            schedule->retry_at = now + SPLIT_TRANSACTION_BACKOFF_MAX;
+            return true;
+        }
+        schedule->waiting = false;
+    }
+
+    int num_retries = (is_transport_connected() && !degraded && !schedule) ? 1 + SPLIT_TRANSACTION_RETRIES : 1;
+#ifdef SPLIT_TRANSPORT_BATCH
+    // Other handlers only see this scan's frame, retrying them cannot change the outcome
+    if (handler != &batch_handlers_master) {
+        num_retries = 1;
+    }
+#endif // SPLIT_TRANSPORT_BATCH
     for (int iter = 1; iter <= num_retries; ++iter) {
-        if (iter > 1) {
-            for (int i = 0; i < iter * iter; ++i) {
-                wait_us(10);
+        if (handler(master_matrix, slave_matrix)) {
+            if (link_errors) {
+                link_errors--;
+            }
+            if (schedule) {
+                schedule->failures = 0;
             }
+            return true;
         }
-        bool this_okay = true;
-        this_okay      = handler(master_matrix, slave_matrix);
-        if (this_okay) return true;
+        link_errors = MIN(link_errors + LINK_ERROR_WEIGHT, LINK_ERRORS_MAX);
     }
     dprintf("Failed to execute %s\n", prefix);
+
+    if (schedule) {
+        if (schedule->failures < UINT8_MAX) {
+            schedule->failures++;
+        }
+        schedule->waiting  = true;
+        schedule->retry_at = timer_read() + MIN(SPLIT_TRANSACTION_BACKOFF_MAX, 1UL << MIN(schedule->failures, 15));
+        return true;
+    }
     return false;
 }
 
-#define TRANSACTION_HANDLER_MASTER(prefix)                                                                              \
-    do {                                                                                                                \
-        if (!transaction_handler_master(master_matrix, slave_matrix, #prefix, &prefix##_handlers_master)) return false; \
+#define TRANSACTION_HANDLER_MASTER(prefix)                                                                                    \
+    do {                                                                                                                      \
+        if (!transaction_handler_master(master_matrix, slave_matrix, #prefix, &prefix##_handlers_master, NULL)) return false; \
+    } while (0)
+
+/**
+ * @brief Constructs a transaction handler for cosmetic data, which must never
+ * hold up the matrix sync. Only use this macro for handlers that send their
+ * current state whenever they run, so skipped runs just delay the update.
+ */
+#define TRANSACTION_HANDLER_MASTER_LOW_PRIORITY(prefix)                                                                  \
+    do {                                                                                                                 \
+        static transaction_schedule_t prefix##_schedule = {0};                                                           \
+        transaction_handler_master(master_matrix, slave_matrix, #prefix, &prefix##_handlers_master, &prefix##_schedule); \
     } while (0)
 
 /**
@@ -175,9 +297,304 @@ inline static bool send_if_data_mismatch(int8_t trans_id, uint32_t *last_update,
     return send_if_condition(trans_id, last_update, (memcmp(source, equiv_shmem, length) != 0), source, length);
 }
 
+////////////////////////////////////////////////////
+// Batched exchange
+
+#ifdef SPLIT_TRANSPORT_BATCH
+
+#    define BATCH_SECTION(id) (1UL << (id))
+// Set in the response sections when the slave accepted the request
+#    define BATCH_ACK BATCH_SECTION(CMD_BATCH_EXCHANGE)
+
+STATIC_ASSERT(sizeof(split_batch_request_t) <= UINT8_MAX, "SPLIT_TRANSPORT_BATCH_SIZE too large");
+STATIC_ASSERT(sizeof(split_batch_response_t) <= UINT8_MAX, "Batched response exceeds the transaction buffer size limit");
+
+static uint32_t batch_pending  = 0; // sections staged for the next exchange
+static uint32_t batch_received = 0; // sections delivered by this scan's exchange
+
+static bool batch_section_valid(int8_t id) {
+#    ifdef USE_I2C
+    if (id == I2C_EXECUTE_CALLBACK) {
+        return false;
+    }
+#    endif // USE_I2C
+#    if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
+    // RPCs keep their own transactions, as do keyboard and user IDs
+    if (id >= PUT_RPC_INFO) {
+#        if defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
+        return id == PUT_DETECTED_OS;
+#        else
+        return false;
+#        endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
+    }
+#    endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
+    return id != CMD_BATCH_EXCHANGE && id >= 0 && id < NUM_TOTAL_TRANSACTIONS;
+}
+
+/**
+ * @brief Stands in for transport_execute_transaction() on the master. Writes
+ * and commands are staged in the shared memory and flagged for the next
+ * exchange, reads are served from the current one.
+ */
+static bool batch_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    // Anything that can never fit a frame still goes out on its own
+    if (!batch_section_valid(id) || trans->initiator2target_buffer_size > SPLIT_TRANSPORT_BATCH_SIZE) {
+        return execute_transaction(id, initiator2target_buf, initiator2target_length, target2initiator_buf, target2initiator_length);
+    }
+
+    if (target2initiator_length > 0) {
+        if (!(batch_received & BATCH_SECTION(id))) {
+            return false;
+        }
+        memcpy(target2initiator_buf, split_trans_target2initiator_buffer(trans), MIN(trans->target2initiator_buffer_size, target2initiator_length));
+    }
+
+    if (initiator2target_length > 0) {
+        memcpy(split_trans_initiator2target_buffer(trans), initiator2target_buf, MIN(trans->initiator2target_buffer_size, initiator2target_length));
+    }
+    if (trans->initiator2target_buffer_size || trans->slave_callback) {
+        batch_pending |= BATCH_SECTION(id);
+    }
+    return true;
+}
+
+static bool batch_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    split_batch_request_t  request  = {0};
+    split_batch_response_t response = {0};
+    uint16_t               length   = 0;
+
+#    ifndef DISABLE_SYNC_TIMER
+    // Staged during the previous scan, bring it up to date
+    if (batch_pending & BATCH_SECTION(PUT_SYNC_TIMER)) {
+        split_shmem->sync_timer = sync_timer_read32() + SYNC_TIMER_OFFSET;
+    }
+#    endif // DISABLE_SYNC_TIMER
+
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        if (!(batch_pending & BATCH_SECTION(id))) {
+            continue;
+        }
+        split_transaction_desc_t *trans = &split_transaction_table[id];
+        // Sections that don't fit are left pending for the next exchange
+        if (length + trans->initiator2target_buffer_size > sizeof(request.payload)) {
+            continue;
+        }
+        memcpy(&request.payload[length], split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size);
+        length += trans->initiator2target_buffer_size;
+        request.sections |= BATCH_SECTION(id);
+    }
+    request.checksum = crc8(&request, offsetof(split_batch_request_t, checksum));
+
+    batch_received = 0;
+    if (!execute_transaction(CMD_BATCH_EXCHANGE, &request, sizeof(request), &response, sizeof(response))) {
+        return false;
+    }
+    if (response.checksum != crc8(&response, offsetof(split_batch_response_t, checksum))) {
+        return false;
+    }
+    if (response.sections & BATCH_ACK) {
+        batch_pending &= ~request.sections;
+    }
+
+    length = 0;
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        if (!(response.sections & BATCH_SECTION(id)) || !batch_section_valid(id)) {
+            continue;
+        }
+        split_transaction_desc_t *trans = &split_transaction_table[id];
+        if (length + trans->target2initiator_buffer_size > sizeof(response.payload)) {
+            return false;
+        }
+        memcpy(split_trans_target2initiator_buffer(trans), &response.payload[length], trans->target2initiator_buffer_size);
+        length += trans->target2initiator_buffer_size;
+        batch_received |= BATCH_SECTION(id);
+    }
+    return true;
+}
+
+static void batch_handlers_slave_exchange(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    const split_batch_request_t *request  = (const split_batch_request_t *)initiator2target_buffer;
+    split_batch_response_t      *response = (split_batch_response_t *)target2initiator_buffer;
+    uint16_t                     length   = 0;
+
+    response->sections = 0;
+    // A damaged request is dropped as a whole, the master resends it on the next exchange
+    if (request->checksum == crc8(request, offsetof(split_batch_request_t, checksum))) {
+        for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+            if (!(request->sections & BATCH_SECTION(id)) || !batch_section_valid(id)) {
+                continue;
+            }
+            split_transaction_desc_t *trans = &split_transaction_table[id];
+            if (length + trans->initiator2target_buffer_size > sizeof(request->payload)) {
+                break;
+            }
+            memcpy(split_trans_initiator2target_buffer(trans), &request->payload[length], trans->initiator2target_buffer_size);
+            length += trans->initiator2target_buffer_size;
+            if (trans->slave_callback) {
+                trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+            }
+        }
+        response->sections |= BATCH_ACK;
+    }
+
+    length = 0;
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        split_transaction_desc_t *trans = &split_transaction_table[id];
+        if (!trans->target2initiator_buffer_size || !batch_section_valid(id) || length + trans->target2initiator_buffer_size > sizeof(response->payload)) {
+            continue;
+        }
+        memcpy(&response->payload[length], split_trans_target2initiator_buffer(trans), trans->target2initiator_buffer_size);
+        length += trans->target2initiator_buffer_size;
+        response->sections |= BATCH_SECTION(id);
+    }
+    response->checksum = crc8(response, offsetof(split_batch_response_t, checksum));
+}
+
+#    define TRANSACTIONS_BATCH_MASTER() TRANSACTION_HANDLER_MASTER(batch)
+#    define TRANSACTIONS_BATCH_REGISTRATIONS [CMD_BATCH_EXCHANGE] = trans_bidirectional_initializer_cb(batch.request, batch.response, batch_handlers_slave_exchange),
+
+#else // SPLIT_TRANSPORT_BATCH
+
+#    define TRANSACTIONS_BATCH_MASTER()
+#    define TRANSACTIONS_BATCH_REGISTRATIONS
+
+#endif // SPLIT_TRANSPORT_BATCH
+
 ////////////////////////////////////////////////////
 // Slave matrix
 
+#ifdef SPLIT_MATRIX_EVENTS_ENABLE
+
+STATIC_ASSERT(((MATRIX_ROWS) / 2) * (MATRIX_COLS) <= SPLIT_MATRIX_EVENT_PRESSED, "Too many keys per half for SPLIT_MATRIX_EVENTS_ENABLE");
+STATIC_ASSERT((SPLIT_MATRIX_EVENTS_SIZE & (SPLIT_MATRIX_EVENTS_SIZE - 1)) == 0 && SPLIT_MATRIX_EVENTS_SIZE <= 128, "SPLIT_MATRIX_EVENTS_SIZE must be a power of two up to 128");
+
+#    define split_matrix_events_checksum(events) crc8(&(events)->sequence, sizeof(split_slave_matrix_events_t) - offsetof(split_slave_matrix_events_t, sequence))
+
+// Events applied by the last sync, for split_matrix_event_time()
+static split_matrix_event_t applied_events[SPLIT_MATRIX_EVENTS_SIZE];
+static uint8_t              applied_count = 0;
+
+/**
+ * @brief Replays the events after `last_sequence` onto `matrix`. Events carry
+ * the resulting key state, so replaying one twice is harmless.
+ *
+ * @return false Events were overwritten before they could be read
+ */
+static bool slave_matrix_apply_events(const split_slave_matrix_events_t *events, uint8_t last_sequence, matrix_row_t matrix[]) {
+    uint8_t count = events->sequence - last_sequence;
+    if (count > SPLIT_MATRIX_EVENTS_SIZE) {
+        return false;
+    }
+
+    applied_count = 0;
+    for (uint8_t sequence = last_sequence + 1; count > 0; sequence++, count--) {
+        const split_matrix_event_t event = events->events[sequence % SPLIT_MATRIX_EVENTS_SIZE];
+        const uint8_t              key   = event.key & ~SPLIT_MATRIX_EVENT_PRESSED;
+        const uint8_t              row   = key / (MATRIX_COLS);
+        const matrix_row_t         mask  = MATRIX_ROW_SHIFTER << (key % (MATRIX_COLS));
+        if (row >= (MATRIX_ROWS) / 2) {
+            return false;
+        }
+        if (event.key & SPLIT_MATRIX_EVENT_PRESSED) {
+            matrix[row] |= mask;
+        } else {
+            matrix[row] &= ~mask;
+        }
+        applied_events[applied_count++] = event;
+    }
+    return true;
+}
+
+static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint32_t             last_update                    = 0;
+    static matrix_row_t         last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are checksum errors
+    static uint8_t              last_sequence                  = 0;
+    static bool                 in_sequence                    = false; // last_sequence matches last_matrix
+    matrix_row_t                temp_matrix[(MATRIX_ROWS) / 2];
+    split_slave_matrix_events_t temp_events;
+    uint8_t                     curr_checksum;
+
+    applied_count = 0;
+    bool okay     = transport_read(GET_SLAVE_MATRIX_CHECKSUM, &curr_checksum, sizeof(curr_checksum));
+    if (okay && (timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS || curr_checksum != crc8(last_matrix, sizeof(last_matrix)))) {
+        okay &= transport_read(GET_SLAVE_MATRIX_EVENTS, &temp_events, sizeof(temp_events));
+        const bool events_valid = okay && temp_events.checksum == split_matrix_events_checksum(&temp_events);
+
+        memcpy(temp_matrix, last_matrix, sizeof(temp_matrix));
+        if (!(events_valid && in_sequence && slave_matrix_apply_events(&temp_events, last_sequence, temp_matrix) && curr_checksum == crc8(temp_matrix, sizeof(temp_matrix))) && okay) {
+            // Missed or damaged events, fall back to the full matrix
+            applied_count = 0;
+            okay &= transport_read(GET_SLAVE_MATRIX_DATA, temp_matrix, sizeof(temp_matrix));
+            okay &= curr_checksum == crc8(temp_matrix, sizeof(temp_matrix));
+        }
+        if (okay) {
+            // Checksum matches the received data, save as the last matrix state
+            memcpy(last_matrix, temp_matrix, sizeof(temp_matrix));
+            last_sequence = temp_events.sequence;
+            in_sequence   = events_valid;
+            last_update   = timer_read32();
+        } else {
+            applied_count = 0;
+        }
+    }
+    // Copy out the last-known-good matrix state to the slave matrix
+    memcpy(slave_matrix, last_matrix, sizeof(last_matrix));
+    return okay;
+}
+
+static void slave_matrix_queue_events(matrix_row_t slave_matrix[]) {
+    split_slave_matrix_events_t *events = &split_shmem->smatrix.events;
+    const uint16_t               time   = sync_timer_read();
+    bool                         queued = false;
+
+    for (uint8_t row = 0; row < (MATRIX_ROWS) / 2; row++) {
+        const matrix_row_t changes = slave_matrix[row] ^ split_shmem->smatrix.matrix[row];
+        if (!changes) {
+            continue;
+        }
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            const matrix_row_t mask = MATRIX_ROW_SHIFTER << col;
+            if (changes & mask) {
+                events->sequence++;
+                split_matrix_event_t *event = &events->events[events->sequence % SPLIT_MATRIX_EVENTS_SIZE];
+                event->key                  = (row * (MATRIX_COLS) + col) | ((slave_matrix[row] & mask) ? SPLIT_MATRIX_EVENT_PRESSED : 0);
+                event->time                 = time;
+                queued                      = true;
+            }
+        }
+    }
+
+    if (queued) {
+        events->checksum = split_matrix_events_checksum(events);
+    }
+}
+
+bool split_matrix_event_time(uint8_t row, uint8_t col, bool pressed, uint16_t *time) {
+#    ifdef DISABLE_SYNC_TIMER
+    // Slave timestamps are not comparable to ours
+    return false;
+#    else
+    const uint8_t first_row = is_keyboard_left() ? (MATRIX_ROWS) / 2 : 0;
+    if (row < first_row || row >= first_row + (MATRIX_ROWS) / 2) {
+        return false;
+    }
+
+    const uint8_t key = ((row - first_row) * (MATRIX_COLS) + col) | (pressed ? SPLIT_MATRIX_EVENT_PRESSED : 0);
+    for (uint8_t i = applied_count; i > 0; i--) {
+        if (applied_events[i - 1].key == key) {
+            // Never hand out a time ahead of ours, which also covers events too old to compare
+            const uint16_t event_time = applied_events[i - 1].time;
+            *time                     = TIMER_DIFF_16(timer_read(), event_time) < 0x8000 ? event_time : timer_read();
+            return true;
+        }
+    }
+    return false;
+#    endif // DISABLE_SYNC_TIMER
+}
+
+#else // SPLIT_MATRIX_EVENTS_ENABLE
+
 static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t     last_update                    = 0;
     static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are checksum errors
@@ -193,17 +610,29 @@ static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_ro
     return okay;
 }
 
+#endif // SPLIT_MATRIX_EVENTS_ENABLE
+
 static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+#ifdef SPLIT_MATRIX_EVENTS_ENABLE
+    slave_matrix_queue_events(slave_matrix);
+#endif // SPLIT_MATRIX_EVENTS_ENABLE
     memcpy(split_shmem->smatrix.matrix, slave_matrix, sizeof(split_shmem->smatrix.matrix));
     split_shmem->smatrix.checksum = crc8(split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
 }
 
+#ifdef SPLIT_MATRIX_EVENTS_ENABLE
+#    define TRANSACTIONS_SLAVE_MATRIX_EVENTS_REGISTRATIONS [GET_SLAVE_MATRIX_EVENTS] = trans_target2initiator_initializer(smatrix.events),
+#else // SPLIT_MATRIX_EVENTS_ENABLE
+#    define TRANSACTIONS_SLAVE_MATRIX_EVENTS_REGISTRATIONS
+#endif // SPLIT_MATRIX_EVENTS_ENABLE
+
 // clang-format off
 #define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
 #define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(slave_matrix)
 #define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
     [GET_SLAVE_MATRIX_CHECKSUM] = trans_target2initiator_initializer(smatrix.checksum), \
-    [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer(smatrix.matrix),
+    [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer(smatrix.matrix), \
+    TRANSACTIONS_SLAVE_MATRIX_EVENTS_REGISTRATIONS
 // clang-format on
 
 ////////////////////////////////////////////////////
@@ -241,25 +670,41 @@ static void master_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_ro
 static bool encoder_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t  last_update   = 0;
     static uint8_t   last_checksum = 0;
+    static uint8_t   applied       = 0; // slave's dequeue count up to which events were applied
+    static bool      drain_pending = false;
     encoder_events_t temp_events;
 
     bool okay = read_if_checksum_mismatch(GET_ENCODERS_CHECKSUM, GET_ENCODERS_DATA, &last_update, &temp_events, &split_shmem->encoders.events, sizeof(temp_events));
     if (okay) {
         if (last_checksum != split_shmem->encoders.checksum) {
-            bool    actioned = false;
-            uint8_t index;
-            bool    clockwise;
-            while (okay && encoder_dequeue_event_advanced(&split_shmem->encoders.events, &index, &clockwise)) {
+            encoder_events_t *events = &split_shmem->encoders.events;
+            uint8_t           index;
+            bool              clockwise;
+
+            // The slave drains later, so skip events still queued that were already applied
+            uint8_t skip = applied - events->dequeued;
+            if (skip > (uint8_t)(events->enqueued - events->dequeued)) {
+                skip = 0;
+            }
+            while (skip-- > 0) {
+                encoder_dequeue_event_advanced(events, &index, &clockwise);
+            }
+
+            while (okay && encoder_dequeue_event_advanced(events, &index, &clockwise)) {
                 okay &= encoder_queue_event(index, clockwise);
-                actioned = true;
             }
 
-            if (actioned) {
-                okay &= transport_exec(CMD_ENCODER_DRAIN);
+            if (applied != events->dequeued) {
+                applied       = events->dequeued;
+                drain_pending = true;
             }
             last_checksum = split_shmem->encoders.checksum;
         }
     }
+    if (drain_pending) {
+        drain_pending = !transport_write(CMD_ENCODER_DRAIN, &applied, sizeof(applied));
+        okay &= !drain_pending;
+    }
     return okay;
 }
 
@@ -271,7 +716,7 @@ static void encoder_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sl
 }
 
 static void encoder_handlers_slave_drain(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
-    encoder_signal_queue_drain();
+    encoder_signal_queue_drain(split_shmem->encoders_drain);
 }
 
 // clang-format off
@@ -280,7 +725,7 @@ static void encoder_handlers_slave_drain(uint8_t initiator2target_buffer_size, c
 #    define TRANSACTIONS_ENCODERS_REGISTRATIONS \
     [GET_ENCODERS_CHECKSUM] = trans_target2initiator_initializer(encoders.checksum), \
     [GET_ENCODERS_DATA]     = trans_target2initiator_initializer(encoders.events), \
-    [CMD_ENCODER_DRAIN]     = trans_initiator2target_cb(encoder_handlers_slave_drain),
+    [CMD_ENCODER_DRAIN]     = trans_initiator2target_initializer_cb(encoders_drain, encoder_handlers_slave_drain),
 // clang-format on
 
 #else // ENCODER_ENABLE
@@ -481,7 +926,7 @@ static void backlight_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
     backlight_level_noeeprom(backlight_level);
 }
 
-#    define TRANSACTIONS_BACKLIGHT_MASTER() TRANSACTION_HANDLER_MASTER(backlight)
+#    define TRANSACTIONS_BACKLIGHT_MASTER() TRANSACTION_HANDLER_MASTER_LOW_PRIORITY(backlight)
 #    define TRANSACTIONS_BACKLIGHT_SLAVE() TRANSACTION_HANDLER_SLAVE(backlight)
 #    define TRANSACTIONS_BACKLIGHT_REGISTRATIONS [PUT_BACKLIGHT] = trans_initiator2target_initializer(backlight_level),
 
@@ -523,7 +968,7 @@ static void rgblight_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
     }
 }
 
-#    define TRANSACTIONS_RGBLIGHT_MASTER() TRANSACTION_HANDLER_MASTER(rgblight)
+#    define TRANSACTIONS_RGBLIGHT_MASTER() TRANSACTION_HANDLER_MASTER_LOW_PRIORITY(rgblight)
 #    define TRANSACTIONS_RGBLIGHT_SLAVE() TRANSACTION_HANDLER_SLAVE(rgblight)
 #    define TRANSACTIONS_RGBLIGHT_REGISTRATIONS [PUT_RGBLIGHT] = trans_initiator2target_initializer(rgblight_sync),
 
@@ -557,7 +1002,7 @@ static void led_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
     led_matrix_set_suspend_state(led_suspend_state);
 }
 
-#    define TRANSACTIONS_LED_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(led_matrix)
+#    define TRANSACTIONS_LED_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER_LOW_PRIORITY(led_matrix)
 #    define TRANSACTIONS_LED_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE(led_matrix)
 #    define TRANSACTIONS_LED_MATRIX_REGISTRATIONS [PUT_LED_MATRIX] = trans_initiator2target_initializer(led_matrix_sync),
 
@@ -591,7 +1036,7 @@ static void rgb_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
     rgb_matrix_set_suspend_state(rgb_suspend_state);
 }
 
-#    define TRANSACTIONS_RGB_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(rgb_matrix)
+#    define TRANSACTIONS_RGB_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER_LOW_PRIORITY(rgb_matrix)
 #    define TRANSACTIONS_RGB_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE(rgb_matrix)
 #    define TRANSACTIONS_RGB_MATRIX_REGISTRATIONS [PUT_RGB_MATRIX] = trans_initiator2target_initializer(rgb_matrix_sync),
 
@@ -618,7 +1063,7 @@ static void wpm_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_
     set_current_wpm(split_shmem->current_wpm);
 }
 
-#    define TRANSACTIONS_WPM_MASTER() TRANSACTION_HANDLER_MASTER(wpm)
+#    define TRANSACTIONS_WPM_MASTER() TRANSACTION_HANDLER_MASTER_LOW_PRIORITY(wpm)
 #    define TRANSACTIONS_WPM_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(wpm)
 #    define TRANSACTIONS_WPM_REGISTRATIONS [PUT_WPM] = trans_initiator2target_initializer(current_wpm),
 
@@ -653,7 +1098,7 @@ static void oled_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave
     }
 }
 
-#    define TRANSACTIONS_OLED_MASTER() TRANSACTION_HANDLER_MASTER(oled)
+#    define TRANSACTIONS_OLED_MASTER() TRANSACTION_HANDLER_MASTER_LOW_PRIORITY(oled)
 #    define TRANSACTIONS_OLED_SLAVE() TRANSACTION_HANDLER_SLAVE(oled)
 #    define TRANSACTIONS_OLED_REGISTRATIONS [PUT_OLED] = trans_initiator2target_initializer(current_oled_state),
 
@@ -688,7 +1133,7 @@ static void st7565_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sla
     }
 }
 
-#    define TRANSACTIONS_ST7565_MASTER() TRANSACTION_HANDLER_MASTER(st7565)
+#    define TRANSACTIONS_ST7565_MASTER() TRANSACTION_HANDLER_MASTER_LOW_PRIORITY(st7565)
 #    define TRANSACTIONS_ST7565_SLAVE() TRANSACTION_HANDLER_SLAVE(st7565)
 #    define TRANSACTIONS_ST7565_REGISTRATIONS [PUT_ST7565] = trans_initiator2target_initializer(current_st7565_state),
 
@@ -803,6 +1248,18 @@ static void watchdog_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
     split_watchdog_update(split_shmem->watchdog_pinged);
 }
 
+bool split_watchdog_stats(int8_t transaction_id, split_transaction_stats_t *stats) {
+    if (transaction_id < 0 || transaction_id >= NUM_TOTAL_TRANSACTIONS) {
+        return false;
+    }
+    memcpy(stats, &transaction_stats[transaction_id], sizeof(split_transaction_stats_t));
+    return true;
+}
+
+void split_watchdog_stats_clear(void) {
+    memset(transaction_stats, 0, sizeof(transaction_stats));
+}
+
 #    define TRANSACTIONS_WATCHDOG_MASTER() TRANSACTION_HANDLER_MASTER(watchdog)
 #    define TRANSACTIONS_WATCHDOG_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(watchdog)
 #    define TRANSACTIONS_WATCHDOG_REGISTRATIONS [PUT_WATCHDOG] = trans_initiator2target_initializer(watchdog_pinged),
@@ -925,6 +1382,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 #endif // USE_I2C
 
     // clang-format off
+    TRANSACTIONS_BATCH_REGISTRATIONS
     TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS
     TRANSACTIONS_MASTER_MATRIX_REGISTRATIONS
     TRANSACTIONS_ENCODERS_REGISTRATIONS
@@ -955,6 +1413,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 };
 
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    TRANSACTIONS_BATCH_MASTER();
     TRANSACTIONS_SLAVE_MATRIX_MASTER();
     TRANSACTIONS_MASTER_MATRIX_MASTER();
     TRANSACTIONS_ENCODERS_MASTER();
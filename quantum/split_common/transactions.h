@@ -45,6 +45,40 @@ extern split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS];
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 
+/**
+ * @brief Whether recent transactions failed often enough that low priority
+ * data, like RGB, WPM and OLED state, is being held back.
+ */
+bool split_transport_degraded(void);
+
+#if defined(SPLIT_WATCHDOG_ENABLE)
+// Link statistics of a transaction ID, as seen by the master
+typedef struct {
+    uint16_t errors;      // failed transactions, saturating
+    uint16_t latency;     // ms from the first failure of the last run of failures to the next success
+    uint16_t latency_max; // worst latency seen
+    uint8_t  failures;    // current run of failures
+} split_transaction_stats_t;
+
+/**
+ * @brief Copies the link statistics of `transaction_id` into `stats`.
+ *
+ * @return false `transaction_id` is out of range
+ */
+bool split_watchdog_stats(int8_t transaction_id, split_transaction_stats_t *stats);
+void split_watchdog_stats_clear(void);
+#endif // defined(SPLIT_WATCHDOG_ENABLE)
+
+#ifdef SPLIT_MATRIX_EVENTS_ENABLE
+/**
+ * @brief Looks up the slave's timestamp of a key change delivered by the last
+ * matrix sync, `row` being a row of the full matrix.
+ *
+ * @return true `time` was set to the timer value the slave saw the change at
+ */
+bool split_matrix_event_time(uint8_t row, uint8_t col, bool pressed, uint16_t *time);
+#endif // SPLIT_MATRIX_EVENTS_ENABLE
+
 void transaction_register_rpc(int8_t transaction_id, slave_callback_t callback);
 
 bool transaction_rpc_exec(int8_t transaction_id, uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
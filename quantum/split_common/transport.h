@@ -52,9 +52,31 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
 #    include "rgblight.h"
 #endif // RGBLIGHT_ENABLE
 
+#ifdef SPLIT_MATRIX_EVENTS_ENABLE
+#    ifndef SPLIT_MATRIX_EVENTS_SIZE
+#        define SPLIT_MATRIX_EVENTS_SIZE 4
+#    endif // SPLIT_MATRIX_EVENTS_SIZE
+
+#    define SPLIT_MATRIX_EVENT_PRESSED 0x80
+
+typedef struct _split_matrix_event_t {
+    uint8_t  key;  // row * MATRIX_COLS + col, ORed with SPLIT_MATRIX_EVENT_PRESSED
+    uint16_t time; // slave's sync timer
+} split_matrix_event_t;
+
+typedef struct _split_slave_matrix_events_t {
+    uint8_t              checksum;
+    uint8_t              sequence; // of the newest event, stored in events[sequence % SPLIT_MATRIX_EVENTS_SIZE]
+    split_matrix_event_t events[SPLIT_MATRIX_EVENTS_SIZE];
+} split_slave_matrix_events_t;
+#endif // SPLIT_MATRIX_EVENTS_ENABLE
+
 typedef struct _split_slave_matrix_sync_t {
     uint8_t      checksum;
     matrix_row_t matrix[(MATRIX_ROWS) / 2];
+#ifdef SPLIT_MATRIX_EVENTS_ENABLE
+    split_slave_matrix_events_t events;
+#endif // SPLIT_MATRIX_EVENTS_ENABLE
 } split_slave_matrix_sync_t;
 
 #ifdef SPLIT_TRANSPORT_MIRROR
@@ -147,11 +169,53 @@ typedef struct _rpc_sync_info_t {
 #    include "os_detection.h"
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
+#ifdef SPLIT_TRANSPORT_BATCH
+#    ifndef SPLIT_TRANSPORT_BATCH_SIZE
+#        define SPLIT_TRANSPORT_BATCH_SIZE 32
+#    endif // SPLIT_TRANSPORT_BATCH_SIZE
+
+#    ifdef ENCODER_ENABLE
+#        define SPLIT_TRANSPORT_BATCH_ENCODERS_SIZE sizeof(split_slave_encoder_sync_t)
+#    else
+#        define SPLIT_TRANSPORT_BATCH_ENCODERS_SIZE 0
+#    endif // ENCODER_ENABLE
+#    if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+#        define SPLIT_TRANSPORT_BATCH_POINTING_SIZE sizeof(split_slave_pointing_sync_t)
+#    else
+#        define SPLIT_TRANSPORT_BATCH_POINTING_SIZE 0
+#    endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+
+// Every slave to master section, sent back on each exchange
+#    define SPLIT_TRANSPORT_BATCH_RESPONSE_SIZE (sizeof(split_slave_matrix_sync_t) + SPLIT_TRANSPORT_BATCH_ENCODERS_SIZE + SPLIT_TRANSPORT_BATCH_POINTING_SIZE)
+
+// Sections are packed in transaction ID order, `sections` has bit n set if transaction n is present
+typedef struct _split_batch_request_t {
+    uint32_t sections;
+    uint8_t  payload[SPLIT_TRANSPORT_BATCH_SIZE];
+    uint8_t  checksum;
+} split_batch_request_t;
+
+typedef struct _split_batch_response_t {
+    uint32_t sections;
+    uint8_t  payload[SPLIT_TRANSPORT_BATCH_RESPONSE_SIZE];
+    uint8_t  checksum;
+} split_batch_response_t;
+
+typedef struct _split_batch_sync_t {
+    split_batch_request_t  request;
+    split_batch_response_t response;
+} split_batch_sync_t;
+#endif // SPLIT_TRANSPORT_BATCH
+
 typedef struct _split_shared_memory_t {
 #ifdef USE_I2C
     int8_t transaction_id;
 #endif // USE_I2C
 
+#ifdef SPLIT_TRANSPORT_BATCH
+    split_batch_sync_t batch;
+#endif // SPLIT_TRANSPORT_BATCH
+
     split_slave_matrix_sync_t smatrix;
 
 #ifdef SPLIT_TRANSPORT_MIRROR
@@ -160,6 +224,7 @@ typedef struct _split_shared_memory_t {
 
 #ifdef ENCODER_ENABLE
     split_slave_encoder_sync_t encoders;
+    uint8_t                    encoders_drain; // slave's dequeue count up to which the master has applied events
 #endif // ENCODER_ENABLE
 
 #ifndef DISABLE_SYNC_TIMER
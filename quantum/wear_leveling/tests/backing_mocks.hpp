@@ -94,9 +94,18 @@ class MockBackingStore {
     std::uint64_t backing_init_invoke_count;
     std::uint64_t backing_unlock_invoke_count;
     std::uint64_t backing_erase_invoke_count;
+    std::uint64_t backing_erase_range_invoke_count;
     std::uint64_t backing_write_invoke_count;
     std::uint64_t backing_lock_invoke_count;
 
+    // The number of times the read APIs were invoked, which are const
+    mutable std::uint64_t backing_read_invoke_count;
+    mutable std::uint64_t backing_read_bulk_invoke_count;
+
+    // The number of element writes/erases performed, and the number after which power is lost
+    std::uint64_t backing_operation_count;
+    std::uint64_t backing_power_loss_limit;
+
     // Whether init should succeed
     std::function<bool(std::uint64_t)> init_success_callback;
     // Whether erase should succeed
@@ -108,6 +117,15 @@ class MockBackingStore {
     // Whether locks should succeed
     std::function<bool(std::uint64_t)> lock_success_callback;
 
+    // Counts an element write/erase, returning false if it should be dropped due to power loss
+    bool consume_operation() {
+        if (backing_operation_count >= backing_power_loss_limit) {
+            return false;
+        }
+        ++backing_operation_count;
+        return true;
+    }
+
     template <typename... Args>
     void append_log(Args&&... args) {
         if (write_log.size() < MOCK_WRITE_LOG_MAX_ENTRIES::value) {
@@ -141,12 +159,21 @@ class MockBackingStore {
     std::uint64_t erase_invoke_count() const {
         return backing_erase_invoke_count;
     }
+    std::uint64_t erase_range_invoke_count() const {
+        return backing_erase_range_invoke_count;
+    }
     std::uint64_t write_invoke_count() const {
         return backing_write_invoke_count;
     }
     std::uint64_t lock_invoke_count() const {
         return backing_lock_invoke_count;
     }
+    std::uint64_t read_invoke_count() const {
+        return backing_read_invoke_count;
+    }
+    std::uint64_t read_bulk_invoke_count() const {
+        return backing_read_bulk_invoke_count;
+    }
 
     // Clear out the internal data for the next run
     void reset_instance();
@@ -159,9 +186,11 @@ class MockBackingStore {
     bool init();
     bool unlock();
     bool erase();
+    bool erase_range(std::uint32_t address, std::size_t length);
     bool write(std::uint32_t address, backing_store_int_t value);
     bool lock();
     bool read(std::uint32_t address, backing_store_int_t& value) const;
+    bool read_bulk(std::uint32_t address, backing_store_int_t* values, std::size_t item_count) const;
 
     // Control over when init/writes/erases should succeed
     void set_init_callback(std::function<bool(std::uint64_t)> callback) {
@@ -180,6 +209,21 @@ class MockBackingStore {
         lock_success_callback = callback;
     }
 
+    // Power loss emulation -- after the given number of further element writes/erases, all writes/erases are silently
+    // dropped until power is restored
+    std::uint64_t operation_count() const {
+        return backing_operation_count;
+    }
+    void set_power_loss_after(std::uint64_t operations) {
+        backing_power_loss_limit = backing_operation_count + operations;
+    }
+    void restore_power() {
+        backing_power_loss_limit = UINT64_MAX;
+    }
+    bool power_lost() const {
+        return backing_operation_count >= backing_power_loss_limit;
+    }
+
     auto storage_begin() const -> decltype(backing_storage.begin()) {
         return backing_storage.begin();
     }
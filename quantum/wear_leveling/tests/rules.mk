@@ -64,3 +64,55 @@ wear_leveling_8byte_SRC := \
 	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_8byte.cpp
 wear_leveling_8byte_INC := \
 	$(wear_leveling_common_INC)
+
+wear_leveling_banked_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=512 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=64 \
+	-DWEAR_LEVELING_BANKED \
+	-DWEAR_LEVELING_BANK_ERASE_SIZE=64 \
+	-DWEAR_LEVELING_BANK_COPY_SIZE=16
+wear_leveling_banked_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_banked.cpp
+wear_leveling_banked_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_playback_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=8192 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=4096
+wear_leveling_playback_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_playback.cpp
+wear_leveling_playback_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_stats_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=2048 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=512 \
+	-DWEAR_LEVELING_STATS
+wear_leveling_stats_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_stats.cpp
+wear_leveling_stats_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_stats_banked_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=2048 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=512 \
+	-DWEAR_LEVELING_STATS \
+	-DWEAR_LEVELING_BANKED \
+	-DWEAR_LEVELING_BANK_ERASE_SIZE=256 \
+	-DWEAR_LEVELING_BANK_COPY_SIZE=64
+wear_leveling_stats_banked_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_stats.cpp
+wear_leveling_stats_banked_INC := \
+	$(wear_leveling_common_INC)
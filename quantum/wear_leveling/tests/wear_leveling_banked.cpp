@@ -0,0 +1,256 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <functional>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+class WearLevelingBanked : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+        std::fill(verify_data.begin(), verify_data.end(), 0);
+    }
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> verify_data;
+
+    wear_leveling_status_t test_write(const uint32_t address, std::uint8_t value) {
+        verify_data[address] = value;
+        return wear_leveling_write(address, &value, sizeof(value));
+    }
+
+    // Single-byte writes below address 64 are a single backing store write each
+    void write_pattern(int first, int count) {
+        for (int i = first; i < first + count; ++i) {
+            test_write((i * 7) % WEAR_LEVELING_LOGICAL_SIZE, (std::uint8_t)(i + 1));
+        }
+    }
+
+    void run_task_until_idle() {
+        for (int i = 0; i < 100; ++i) {
+            if (wear_leveling_task() == WEAR_LEVELING_CONSOLIDATED) {
+                return;
+            }
+        }
+        FAIL() << "Consolidation never committed";
+    }
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback() {
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> data;
+        wear_leveling_read(0, data.data(), data.size());
+        return data;
+    }
+};
+
+// Entries in each bank's write log before consolidation starts in the background
+static constexpr int LOG_ENTRIES_BEFORE_CONSOLIDATION = ((WEAR_LEVELING_BANK_SIZE) - (WEAR_LEVELING_LOG_START)) / 2 / BACKING_STORE_WRITE_SIZE;
+
+/**
+ * This test verifies that the first write occurs after the hash and commit record of the first bank.
+ */
+TEST_F(WearLevelingBanked, FirstWriteOccursAfterCommitRecord) {
+    auto& inst = MockBackingStore::Instance();
+    test_write(0x02, 0x15);
+    EXPECT_EQ(inst.log_begin()->address, WEAR_LEVELING_LOGICAL_SIZE + 16) << "Invalid first write address.";
+}
+
+/**
+ * This test verifies that writes never erase in-line while the task keeps up, and that the consolidated data survives a
+ * re-init.
+ */
+TEST_F(WearLevelingBanked, WritesNeverEraseWhileTaskRuns) {
+    auto& inst = MockBackingStore::Instance();
+
+    for (int i = 0; i < 1000; ++i) {
+        const auto erases = inst.erase_invoke_count() + inst.erase_range_invoke_count();
+        EXPECT_EQ(test_write((i * 13) % WEAR_LEVELING_LOGICAL_SIZE, (std::uint8_t)(i + 1)), WEAR_LEVELING_SUCCESS);
+        EXPECT_EQ(inst.erase_invoke_count() + inst.erase_range_invoke_count(), erases) << "Write " << i << " erased in-line";
+        wear_leveling_task();
+    }
+    EXPECT_EQ(inst.erase_invoke_count(), 0);
+    EXPECT_GT(inst.erase_range_invoke_count(), 0);
+
+    EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Re-initialisation failed";
+    EXPECT_EQ(readback(), verify_data) << "Readback did not match";
+}
+
+/**
+ * This test verifies that consolidation only starts once the write log is half full, and takes a step per task call.
+ */
+TEST_F(WearLevelingBanked, ConsolidationIsIncremental) {
+    auto& inst = MockBackingStore::Instance();
+
+    write_pattern(0, LOG_ENTRIES_BEFORE_CONSOLIDATION - 1);
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS);
+    EXPECT_EQ(inst.erase_range_invoke_count(), 0) << "Consolidation started early";
+
+    write_pattern(LOG_ENTRIES_BEFORE_CONSOLIDATION - 1, 1);
+    const int erase_steps = WEAR_LEVELING_BANK_SIZE / WEAR_LEVELING_BANK_ERASE_SIZE;
+    const int copy_steps  = WEAR_LEVELING_LOGICAL_SIZE / WEAR_LEVELING_BANK_COPY_SIZE;
+    int       steps       = 0;
+    auto      status      = WEAR_LEVELING_SUCCESS;
+    do {
+        status = wear_leveling_task();
+        ++steps;
+        EXPECT_EQ(inst.erase_range_invoke_count(), std::min(steps, erase_steps));
+    } while (status == WEAR_LEVELING_SUCCESS && steps < 100);
+    EXPECT_EQ(status, WEAR_LEVELING_CONSOLIDATED);
+    EXPECT_EQ(steps, erase_steps + copy_steps + 2) << "Erase, copy, hash and commit steps";
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS);
+    EXPECT_EQ(inst.erase_range_invoke_count(), erase_steps) << "Task kept going after commit";
+
+    // Subsequent writes land in the second bank
+    test_write(0x01, 0xAA);
+    EXPECT_GE((inst.log_end() - 1)->address, WEAR_LEVELING_BANK_SIZE + WEAR_LEVELING_LOG_START);
+
+    EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Re-initialisation failed";
+    EXPECT_EQ(readback(), verify_data) << "Readback did not match";
+}
+
+/**
+ * This test verifies that writes made during consolidation, both before and after the affected data was copied, are
+ * kept once the new bank is committed.
+ */
+TEST_F(WearLevelingBanked, WritesDuringConsolidationAreKept) {
+    write_pattern(0, LOG_ENTRIES_BEFORE_CONSOLIDATION);
+
+    for (int i = 0; i < 100; ++i) {
+        test_write(0, (std::uint8_t)(0x80 + i));
+        test_write(WEAR_LEVELING_LOGICAL_SIZE - 1, (std::uint8_t)(0x40 + i));
+        if (wear_leveling_task() == WEAR_LEVELING_CONSOLIDATED) {
+            break;
+        }
+    }
+    test_write(1, 0x55);
+
+    EXPECT_EQ(readback(), verify_data) << "Readback did not match";
+    EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Re-initialisation failed";
+    EXPECT_EQ(readback(), verify_data) << "Readback did not match";
+}
+
+/**
+ * This test verifies that a full write log is consolidated in-line if the task never runs, and that the banks keep
+ * alternating.
+ */
+TEST_F(WearLevelingBanked, FullLogConsolidatesInline) {
+    auto& inst = MockBackingStore::Instance();
+    int   next = 0;
+    for (int round = 0; round < 3; ++round) {
+        wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+        while (status == WEAR_LEVELING_SUCCESS && next < 1000) {
+            status = test_write((next * 7) % WEAR_LEVELING_LOGICAL_SIZE, (std::uint8_t)(next + 1));
+            ++next;
+        }
+        EXPECT_EQ(status, WEAR_LEVELING_CONSOLIDATED) << "Round " << round;
+        EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Re-initialisation failed";
+        EXPECT_EQ(readback(), verify_data) << "Readback did not match, round " << round;
+    }
+    EXPECT_EQ(inst.erase_invoke_count(), 0);
+}
+
+/**
+ * This test verifies that an erase resets to the first, uncommitted, bank.
+ */
+TEST_F(WearLevelingBanked, EraseResetsBanks) {
+    auto& inst = MockBackingStore::Instance();
+    write_pattern(0, LOG_ENTRIES_BEFORE_CONSOLIDATION);
+    run_task_until_idle();
+
+    EXPECT_EQ(wear_leveling_erase(), WEAR_LEVELING_SUCCESS);
+    test_write(0x02, 0x15);
+    EXPECT_EQ((inst.log_end() - 1)->address, WEAR_LEVELING_LOGICAL_SIZE + 16) << "Invalid first write address after erase.";
+
+    std::fill(verify_data.begin(), verify_data.end(), 0);
+    verify_data[0x02] = 0x15;
+    EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Re-initialisation failed";
+    EXPECT_EQ(readback(), verify_data) << "Readback did not match";
+}
+
+/**
+ * Cuts power after every possible backing store operation of the given scenario, verifying that after a reboot the
+ * logical data matches either the last write that completed, or the one in flight, and that the store is still usable.
+ */
+static void verify_power_loss(std::function<void()> setup, std::function<void(std::function<void(uint32_t, std::uint8_t)>)> scenario) {
+    auto& inst = MockBackingStore::Instance();
+
+    // Dry run to count the operations involved
+    inst.reset_instance();
+    wear_leveling_init();
+    setup();
+    const auto first = inst.operation_count();
+    scenario([](uint32_t address, std::uint8_t value) { wear_leveling_write(address, &value, sizeof(value)); });
+    const auto total = inst.operation_count() - first;
+    ASSERT_GT(total, 0);
+
+    for (std::uint64_t cut = 0; cut <= total; ++cut) {
+        inst.reset_instance();
+        wear_leveling_init();
+        setup();
+
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> durable;
+        wear_leveling_read(0, durable.data(), durable.size());
+        auto in_flight = durable;
+
+        inst.set_power_loss_after(cut);
+        scenario([&](uint32_t address, std::uint8_t value) {
+            const bool lost_before = inst.power_lost();
+            wear_leveling_write(address, &value, sizeof(value));
+            if (lost_before) {
+                return;
+            }
+            in_flight[address] = value;
+            if (!inst.power_lost()) {
+                durable = in_flight;
+            }
+        });
+
+        // Reboot
+        inst.restore_power();
+        EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Re-initialisation failed, cut after " << cut;
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> data;
+        wear_leveling_read(0, data.data(), data.size());
+        EXPECT_TRUE(data == durable || data == in_flight) << "Unexpected data after power loss, cut after " << cut << " of " << total;
+
+        // Keep going through a full consolidation, the interrupted one is restarted from scratch
+        for (int i = 0; i < 200; ++i) {
+            std::uint8_t value                   = (std::uint8_t)(0xC0 + i);
+            data[i % WEAR_LEVELING_LOGICAL_SIZE] = value;
+            wear_leveling_write(i % WEAR_LEVELING_LOGICAL_SIZE, &value, sizeof(value));
+            wear_leveling_task();
+        }
+        EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Re-initialisation failed, cut after " << cut;
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> after;
+        wear_leveling_read(0, after.data(), after.size());
+        EXPECT_EQ(after, data) << "Store unusable after power loss, cut after " << cut;
+
+        if (::testing::Test::HasFailure()) {
+            break;
+        }
+    }
+}
+
+/**
+ * Power loss at every step of a background consolidation, including the one following it into the first bank.
+ */
+TEST_F(WearLevelingBanked, PowerLossDuringBackgroundConsolidation) {
+    verify_power_loss([this]() { write_pattern(0, LOG_ENTRIES_BEFORE_CONSOLIDATION - 4); },
+                      [](std::function<void(uint32_t, std::uint8_t)> write) {
+                          for (int i = 0; i < 3 * LOG_ENTRIES_BEFORE_CONSOLIDATION; ++i) {
+                              write((i * 11) % WEAR_LEVELING_LOGICAL_SIZE, (std::uint8_t)(0x30 + i));
+                              wear_leveling_task();
+                          }
+                      });
+}
+
+/**
+ * Power loss at every step of an in-line consolidation, with the task never running.
+ */
+TEST_F(WearLevelingBanked, PowerLossDuringInlineConsolidation) {
+    verify_power_loss([this]() { write_pattern(0, LOG_ENTRIES_BEFORE_CONSOLIDATION); },
+                      [](std::function<void(uint32_t, std::uint8_t)> write) {
+                          for (int i = 0; i < 2 * LOG_ENTRIES_BEFORE_CONSOLIDATION; ++i) {
+                              write((i * 11) % WEAR_LEVELING_LOGICAL_SIZE, (std::uint8_t)(0x30 + i));
+                          }
+                      });
+}
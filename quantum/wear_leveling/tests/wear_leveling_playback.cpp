@@ -0,0 +1,90 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <iostream>
+#include <random>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+class WearLevelingPlayback : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+        std::fill(verify_data.begin(), verify_data.end(), 0);
+    }
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> verify_data;
+
+    // Fills the write log with a mix of entry types, stopping short of consolidation, returning the backing store
+    // items written to the log
+    std::uint64_t fill_log(std::uint32_t seed) {
+        auto&                                        inst = MockBackingStore::Instance();
+        std::mt19937                                 rng(seed);
+        std::uniform_int_distribution<std::uint32_t> address(0, WEAR_LEVELING_LOGICAL_SIZE - 8);
+        std::uniform_int_distribution<int>           length(1, 8);
+        std::uniform_int_distribution<int>           value(0, 255);
+        std::uniform_int_distribution<int>           small(0, 1);
+        const std::uint32_t                          log_space = (WEAR_LEVELING_BACKING_SIZE) - (WEAR_LEVELING_LOG_START);
+        std::uint64_t                                written   = 0;
+        std::vector<std::uint8_t>                    buf;
+
+        // Leave room for the largest write, split into two multibyte entries
+        while ((written + 8) * BACKING_STORE_WRITE_SIZE < log_space) {
+            const std::uint32_t a = address(rng);
+            buf.resize(length(rng));
+            for (auto& b : buf) {
+                // Plenty of 0/1 words to exercise the 2-byte optimized encodings
+                b = small(rng) ? (std::uint8_t)small(rng) : (std::uint8_t)value(rng);
+            }
+            std::copy(buf.begin(), buf.end(), verify_data.begin() + a);
+
+            const auto before = inst.write_invoke_count();
+            EXPECT_EQ(wear_leveling_write(a, buf.data(), buf.size()), WEAR_LEVELING_SUCCESS);
+            written += inst.write_invoke_count() - before;
+        }
+        return written;
+    }
+};
+
+/**
+ * This test verifies that a nearly full write log is played back correctly, including entries which straddle the
+ * playback buffer.
+ */
+TEST_F(WearLevelingPlayback, FullLogPlayback) {
+    for (std::uint32_t seed = 1; seed <= 8; ++seed) {
+        SetUp();
+        fill_log(seed);
+        EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Playback failed, seed " << seed;
+
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+        wear_leveling_read(0, readback.data(), readback.size());
+        EXPECT_EQ(readback, verify_data) << "Readback did not match, seed " << seed;
+    }
+}
+
+/**
+ * Boot-time benchmark -- the number of backing store reads required to play back a nearly full write log.
+ */
+TEST_F(WearLevelingPlayback, BootBenchmark) {
+    auto&      inst  = MockBackingStore::Instance();
+    const auto items = fill_log(0x5EED);
+
+    const auto reads      = inst.read_invoke_count();
+    const auto bulk_reads = inst.read_bulk_invoke_count();
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS);
+    const auto init_reads      = inst.read_invoke_count() - reads;
+    const auto init_bulk_reads = inst.read_bulk_invoke_count() - bulk_reads;
+
+    std::cout << "Replayed " << items << " log items (" << items * BACKING_STORE_WRITE_SIZE << " bytes): " << init_reads << " reads, " << init_bulk_reads << " bulk reads" << std::endl;
+
+    // Consolidated data, its hash, then one bulk read per buffer of the log
+    const auto buffers = (items * BACKING_STORE_WRITE_SIZE + WEAR_LEVELING_PLAYBACK_BUFFER_SIZE) / WEAR_LEVELING_PLAYBACK_BUFFER_SIZE;
+    EXPECT_EQ(init_reads, 0);
+    EXPECT_LE(init_bulk_reads, 2 + buffers);
+    EXPECT_LT(init_reads + init_bulk_reads, items / 8) << "Playback should not read the log item by item";
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+    wear_leveling_read(0, readback.data(), readback.size());
+    EXPECT_EQ(readback, verify_data) << "Readback did not match";
+}
@@ -0,0 +1,230 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+class WearLevelingStats : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+    }
+
+    wear_leveling_stats_t stats() {
+        wear_leveling_stats_t s;
+        wear_leveling_get_stats(&s);
+        return s;
+    }
+
+    wear_leveling_lifetime_t lifetime() {
+        wear_leveling_lifetime_t l;
+        wear_leveling_get_lifetime(&l);
+        return l;
+    }
+
+    // Writes keep going until the requested number of consolidations have been committed, running the background task
+    // between writes as the keyboard would
+    void write_until_consolidated(std::uint32_t consolidations) {
+        std::uint32_t i = 0;
+        while (stats().consolidations < consolidations) {
+            const std::uint16_t value = 0x100 + (i % 0x1000);
+            EXPECT_NE(wear_leveling_write(64 + (i * 2) % (WEAR_LEVELING_LOGICAL_SIZE - 64), &value, sizeof(value)), WEAR_LEVELING_FAILED);
+            wear_leveling_task();
+            ASSERT_LT(++i, 100000u) << "Consolidation never happened";
+        }
+    }
+};
+
+static void expect_stats_eq(const wear_leveling_stats_t& a, const wear_leveling_stats_t& b) {
+    EXPECT_EQ(a.logical_bytes, b.logical_bytes);
+    EXPECT_EQ(a.entries[0], b.entries[0]);
+    EXPECT_EQ(a.entries[1], b.entries[1]);
+    EXPECT_EQ(a.entries[2], b.entries[2]);
+    EXPECT_EQ(a.backing_bytes, b.backing_bytes);
+    EXPECT_EQ(a.consolidations, b.consolidations);
+    EXPECT_EQ(a.erases, b.erases);
+}
+
+/**
+ * This test verifies that each write log entry type is counted, along with the logical and backing store bytes.
+ */
+TEST_F(WearLevelingStats, CountsEntriesByType) {
+    const std::uint8_t  byte    = 0x42;
+    const std::uint16_t word    = 1;
+    const std::uint8_t  multi[] = {0x11, 0x22, 0x33};
+    EXPECT_EQ(wear_leveling_write(2, &byte, sizeof(byte)), WEAR_LEVELING_SUCCESS);
+    EXPECT_EQ(wear_leveling_write(100, &word, sizeof(word)), WEAR_LEVELING_SUCCESS);
+    EXPECT_EQ(wear_leveling_write(200, multi, sizeof(multi)), WEAR_LEVELING_SUCCESS);
+
+    const auto s = stats();
+    EXPECT_EQ(s.logical_bytes, 6u);
+    EXPECT_EQ(s.entries[0], 1u) << "Multi-byte entries";
+    EXPECT_EQ(s.entries[1], 1u) << "Address < 64 entries";
+    EXPECT_EQ(s.entries[2], 1u) << "Word 0/1 entries";
+    EXPECT_EQ(s.backing_bytes, 5u * BACKING_STORE_WRITE_SIZE) << "One item each for the optimized entries, three for the multi-byte entry";
+    EXPECT_EQ(s.consolidations, 0u);
+    EXPECT_EQ(s.erases, 0u);
+}
+
+/**
+ * This test verifies that writes which leave the logical data unchanged are not counted.
+ */
+TEST_F(WearLevelingStats, UnchangedWritesNotCounted) {
+    const std::uint8_t value = 0x42;
+    EXPECT_EQ(wear_leveling_write(100, &value, sizeof(value)), WEAR_LEVELING_SUCCESS);
+    EXPECT_EQ(wear_leveling_write(100, &value, sizeof(value)), WEAR_LEVELING_SUCCESS);
+    EXPECT_EQ(stats().logical_bytes, 1u);
+    EXPECT_EQ(stats().entries[0], 1u);
+}
+
+/**
+ * This test verifies that the statistics survive a re-init, both from the persisted record alone and with write log
+ * entries appended since.
+ */
+TEST_F(WearLevelingStats, PersistsAcrossReinit) {
+    write_until_consolidated(3);
+    auto before = stats();
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS);
+    expect_stats_eq(stats(), before);
+
+    const std::uint8_t bytes[] = {1, 2, 3, 4, 5, 6, 7};
+    EXPECT_NE(wear_leveling_write(2, bytes, 1), WEAR_LEVELING_FAILED);
+    EXPECT_NE(wear_leveling_write(300, bytes, sizeof(bytes)), WEAR_LEVELING_FAILED);
+    before = stats();
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS);
+    expect_stats_eq(stats(), before);
+}
+
+/**
+ * This test verifies that a clean backing store starts the statistics from zero, and that erases are counted and kept.
+ */
+TEST_F(WearLevelingStats, EraseCountedAndPersisted) {
+    expect_stats_eq(stats(), wear_leveling_stats_t{});
+
+    const std::uint8_t value = 0x42;
+    EXPECT_EQ(wear_leveling_write(100, &value, sizeof(value)), WEAR_LEVELING_SUCCESS);
+    EXPECT_EQ(wear_leveling_erase(), WEAR_LEVELING_SUCCESS);
+    const auto before = stats();
+#ifdef WEAR_LEVELING_BANKED
+    EXPECT_EQ(before.erases, 2u) << "One for each bank";
+#else
+    EXPECT_EQ(before.erases, 1u);
+#endif
+    EXPECT_EQ(before.logical_bytes, 1u);
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS);
+    expect_stats_eq(stats(), before);
+}
+
+/**
+ * This test verifies that a reset clears the statistics, and is persisted by the next consolidation.
+ */
+TEST_F(WearLevelingStats, ResetPersistedOnConsolidation) {
+    write_until_consolidated(1);
+    wear_leveling_reset_stats();
+    expect_stats_eq(stats(), wear_leveling_stats_t{});
+
+    write_until_consolidated(1);
+    const auto before = stats();
+    EXPECT_EQ(before.consolidations, 1u);
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS);
+    expect_stats_eq(stats(), before);
+}
+
+/**
+ * This test verifies the projected lifetime against the erase cycles implied by the statistics.
+ */
+TEST_F(WearLevelingStats, ProjectedLifetime) {
+    EXPECT_EQ(lifetime().worn_millicycles, 0u);
+    EXPECT_EQ(lifetime().projected_logical_bytes, 0u) << "No projection without any wear";
+
+    write_until_consolidated(4);
+    const auto s = stats();
+    const auto l = lifetime();
+#ifdef WEAR_LEVELING_BANKED
+    // Each consolidation erases the other bank, so each bank has been erased twice
+    EXPECT_EQ(s.erases, 4u);
+    EXPECT_EQ(l.worn_millicycles, 2000u);
+#else
+    // Each consolidation erases the backing store, and has just emptied the write log
+    EXPECT_EQ(s.erases, 4u);
+    EXPECT_EQ(l.worn_millicycles, 4000u);
+#endif
+    EXPECT_EQ(l.used_permille, l.worn_millicycles / WEAR_LEVELING_ENDURANCE);
+    EXPECT_EQ(l.projected_logical_bytes, (std::uint64_t)s.logical_bytes * WEAR_LEVELING_ENDURANCE * 1000 / l.worn_millicycles);
+}
+
+#ifdef WEAR_LEVELING_BANKED
+/**
+ * This test verifies that the projected lifetime follows the most worn bank, across restarts.
+ */
+TEST_F(WearLevelingStats, MostWornBankPersisted) {
+    // Bank 1, bank 0, then bank 1 again
+    write_until_consolidated(3);
+    const auto s = stats();
+    const auto l = lifetime();
+    EXPECT_EQ(s.erases, 3u);
+    EXPECT_EQ(l.worn_millicycles, 2000u);
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS);
+    expect_stats_eq(stats(), s);
+    EXPECT_EQ(lifetime().worn_millicycles, l.worn_millicycles);
+
+    // Erasing the backing store wears both banks
+    EXPECT_EQ(wear_leveling_erase(), WEAR_LEVELING_SUCCESS);
+    EXPECT_EQ(stats().erases, 5u);
+    EXPECT_EQ(lifetime().worn_millicycles, 3000u);
+}
+#endif // WEAR_LEVELING_BANKED
+
+/**
+ * Write amplification and projected lifetime of simulated feature write patterns, for comparing backing store sizes
+ * and configurations.
+ */
+TEST_F(WearLevelingStats, FeatureWritePatterns) {
+    struct pattern {
+        const char*                          name;
+        std::function<void(std::mt19937&)> write;
+    };
+    const pattern patterns[] = {
+        // eeconfig_update_rgblight() on every mode change: 4 bytes at a fixed low address
+        {"rgblight mode saves",
+         [](std::mt19937& rng) {
+             const std::uint32_t config = rng();
+             wear_leveling_write(16, &config, sizeof(config));
+         }},
+        // VIA keymap edits: one 2-byte keycode at a time, often KC_NO or KC_TRNS
+        {"dynamic keymap edits",
+         [](std::mt19937& rng) {
+             const std::uint16_t keycode = rng() % 3 ? (std::uint16_t)(rng() % 2) : (std::uint16_t)(0x04 + rng() % 0x60);
+             wear_leveling_write(64 + (rng() % ((WEAR_LEVELING_LOGICAL_SIZE - 64) / 2)) * 2, &keycode, sizeof(keycode));
+         }},
+        // Dynamic tapping term: a single 2-byte value nudged up and down
+        {"tapping term tweaks",
+         [](std::mt19937& rng) {
+             const std::uint16_t term = 150 + rng() % 100;
+             wear_leveling_write(40, &term, sizeof(term));
+         }},
+    };
+
+    for (const auto& p : patterns) {
+        SetUp();
+        std::mt19937 rng(0x5EED);
+        for (int i = 0; i < 5000; ++i) {
+            p.write(rng);
+            wear_leveling_task();
+        }
+
+        const auto s = stats();
+        const auto l = lifetime();
+        std::cout << std::left << std::setw(24) << p.name << std::right << " logical=" << s.logical_bytes << " backing=" << s.backing_bytes << " amplification=" << std::fixed << std::setprecision(2) << (double)s.backing_bytes / s.logical_bytes << " consolidations=" << s.consolidations << " erases=" << s.erases << " projected=" << l.projected_logical_bytes / 1024 << " kB" << std::endl;
+
+        EXPECT_GT(s.backing_bytes, s.logical_bytes) << p.name;
+        EXPECT_GT(l.projected_logical_bytes, 0u) << p.name;
+    }
+}
@@ -1,6 +1,7 @@
 // Copyright 2022 Nick Brassel (@tzarc)
 // SPDX-License-Identifier: GPL-2.0-or-later
 #include <stdbool.h>
+#include <stddef.h>
 #include "fnv.h"
 #include "wear_leveling.h"
 #include "wear_leveling_drivers.h"
@@ -62,12 +63,35 @@
             to other subsystems performing reads/writes. This must be a multiple
             of the write size.
 
+        - WEAR_LEVELING_PLAYBACK_BUFFER_SIZE: The number of bytes of the write
+            log read from the backing store at a time during initialization.
+
+        - WEAR_LEVELING_BANKED: Splits the backing store into two banks and
+            consolidates in the background, see below. This changes the
+            layout of the backing store, data written without it is not read
+            back after enabling it, and vice versa.
+
+        - WEAR_LEVELING_BANK_ERASE_SIZE: With WEAR_LEVELING_BANKED, the number
+            of bytes erased per background step. Must divide the bank size and
+            be a multiple of the backing store's erase granularity. Required,
+            unless the backing store driver defaults it to its sector size.
+
+        - WEAR_LEVELING_BANK_COPY_SIZE: With WEAR_LEVELING_BANKED, the number
+            of bytes of consolidated data written per background step.
+
+        - WEAR_LEVELING_STATS: Keeps write-amplification statistics, see
+            below.
+
+        - WEAR_LEVELING_ENDURANCE: With WEAR_LEVELING_STATS, the rated number
+            of erase cycles of the backing store, used for the projected
+            lifetime.
+
     General algorithm:
 
         During initialization:
             * The contents of the consolidated data section are read into cache.
             * The contents of the write log are "played back" and update the
-                cache accordingly.
+                cache accordingly. The log is read in bulk, a buffer at a time.
 
         During reads:
             * Logical data is served from the cache.
@@ -154,7 +178,55 @@
         ║  │Address >> 1 ║
         ║  └── Value: 1  ║
         ╚════════════════╝
-        0 <= Address <= 0x3FFE (16382) */
+        0 <= Address <= 0x3FFE (16382)
+
+    Banked consolidation (WEAR_LEVELING_BANKED):
+
+        The backing store is split into two banks of half the backing size,
+        each laid out as above, with an 8-byte commit record between the
+        FNV1a_64 hash and the write log:
+
+        ╔ Bank ══════════════════════════════════════════════════════════╗
+        ║ Consolidated data ║ FNV1a_64 ║ Sequence | Magic ║ Write log... ║
+        ║  (logical size)   ║ 8 bytes  ║ 4 bytes  |4 bytes║              ║
+        ╚════════════════════════════════════════════════════════════════╝
+
+        On startup the committed bank (valid magic) with the highest sequence
+        number is used, falling back to the first bank if neither is
+        committed.
+
+        Once the active write log is half full, wear_leveling_task() starts
+        consolidating into the other bank one step at a time: erasing it in
+        WEAR_LEVELING_BANK_ERASE_SIZE chunks, copying the cache in
+        WEAR_LEVELING_BANK_COPY_SIZE chunks, then writing the hash and finally
+        the commit record, sequence first and magic last. Writes keep being
+        appended to the active bank meanwhile; writes to logical data that has
+        already been copied are also appended to the other bank's write log.
+        A power loss at any point leaves the previous bank as the newest
+        committed one, and the consolidation restarts from the erase.
+
+        If the active write log fills up before the task gets there, the
+        consolidation is performed in-line as without banking.
+
+    Statistics (WEAR_LEVELING_STATS):
+
+        A 40-byte record of the statistics is stored immediately before the
+        write log, i.e. after the FNV1a_64 hash, or after the commit record
+        with WEAR_LEVELING_BANKED:
+
+        ╔ Statistics record ═══════════════════════════════════════════╗
+        ║ wear_leveling_stats_t ║ Log offset ║ Bank 1 erases ║ FNV1a_32 ║
+        ║       28 bytes        ║  4 bytes   ║    4 bytes    ║ 4 bytes  ║
+        ╚══════════════════════════════════════════════════════════════╝
+
+        It is written during consolidation -- just ahead of the commit record
+        with WEAR_LEVELING_BANKED -- and after an erase. The log offset marks
+        the first write log entry not yet included, entries from there on
+        are added to the statistics as they are played back on startup. An
+        invalid record, such as on a clean MCU, starts the statistics from
+        zero. With WEAR_LEVELING_BANKED, every bank erase is counted when it
+        starts, and the record also keeps how many of them were of bank 1, so
+        the projected lifetime follows the most worn bank. */
 
 /**
  * Storage area for the wear-leveling cache.
@@ -163,8 +235,51 @@ static struct __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) {
     __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) uint8_t cache[(WEAR_LEVELING_LOGICAL_SIZE)];
     uint32_t                                                       write_address;
     bool                                                           unlocked;
+#ifdef WEAR_LEVELING_BANKED
+    uint8_t  bank;           // The bank currently being read from and appended to
+    uint32_t sequence;       // Sequence number of the active bank's commit record, 0 if not committed
+    uint8_t  step;           // Consolidation step, see wear_leveling_bank_step_t
+    uint32_t progress;       // Bytes of the other bank erased, or of the cache copied, so far
+    uint32_t mirror_address; // Next write log location in the other bank
+    bool     mirror;         // Whether log entries are also appended to the other bank
+    uint64_t hash;           // Running FNV1a_64 of the copied cache
+#endif // WEAR_LEVELING_BANKED
+#ifdef WEAR_LEVELING_STATS
+    wear_leveling_stats_t stats;
+    uint32_t              stats_replay_from; // First write log entry not included in the persisted statistics
+#    ifdef WEAR_LEVELING_BANKED
+    uint32_t bank1_erases; // Erasures of bank 1 included in stats.erases
+#    endif // WEAR_LEVELING_BANKED
+#endif     // WEAR_LEVELING_STATS
 } wear_leveling;
 
+#ifdef WEAR_LEVELING_STATS
+STATIC_ASSERT(sizeof(((wear_leveling_stats_t *)0)->entries) / sizeof(uint32_t) == LOG_ENTRY_TYPES, "Wear leveling statistics entry types mismatch");
+#    define wl_stats_add(field, n) (wear_leveling.stats.field += (n))
+#else
+#    define wl_stats_add(field, n) \
+        do {                       \
+        } while (0)
+#endif // WEAR_LEVELING_STATS
+
+#ifdef WEAR_LEVELING_BANKED
+/**
+ * Background consolidation steps.
+ */
+typedef enum wear_leveling_bank_step_t { BANK_STEP_IDLE = 0, BANK_STEP_ERASING, BANK_STEP_COPYING, BANK_STEP_HASH, BANK_STEP_COMMIT } wear_leveling_bank_step_t;
+#endif // WEAR_LEVELING_BANKED
+
+/**
+ * Offset of the active bank within the backing store.
+ */
+static inline uint32_t wear_leveling_bank_base(void) {
+#ifdef WEAR_LEVELING_BANKED
+    return wear_leveling.bank ? (WEAR_LEVELING_BANK_SIZE) : 0;
+#else
+    return 0;
+#endif // WEAR_LEVELING_BANKED
+}
+
 /**
  * Locking helper: status
  */
@@ -198,12 +313,38 @@ static inline backing_store_lock_status_t wear_leveling_lock(void) {
     return STATUS_SUCCESS;
 }
 
+/**
+ * Reads an 8-byte record, such as the FNV1a_64 hash, from the backing store.
+ */
+static bool wear_leveling_read_record(uint32_t address, write_log_entry_t *entry) {
+#if BACKING_STORE_WRITE_SIZE == 2
+    return backing_store_read_bulk(address, entry->raw16, 4);
+#elif BACKING_STORE_WRITE_SIZE == 4
+    return backing_store_read_bulk(address, entry->raw32, 2);
+#elif BACKING_STORE_WRITE_SIZE == 8
+    return backing_store_read(address, &entry->raw64);
+#endif
+}
+
+/**
+ * Writes an 8-byte record, such as the FNV1a_64 hash, to the backing store, lowest address first.
+ */
+static bool wear_leveling_write_record(uint32_t address, write_log_entry_t *entry) {
+#if BACKING_STORE_WRITE_SIZE == 2
+    return backing_store_write_bulk(address, entry->raw16, 4);
+#elif BACKING_STORE_WRITE_SIZE == 4
+    return backing_store_write_bulk(address, entry->raw32, 2);
+#elif BACKING_STORE_WRITE_SIZE == 8
+    return backing_store_write(address, entry->raw64);
+#endif
+}
+
 /**
  * Resets the cache, ensuring the write address is correctly initialised.
  */
 static void wear_leveling_clear_cache(void) {
     memset(wear_leveling.cache, 0, (WEAR_LEVELING_LOGICAL_SIZE));
-    wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 is due to the FNV1a_64 of the consolidated buffer
+    wear_leveling.write_address = wear_leveling_bank_base() + (WEAR_LEVELING_LOG_START); // skips the FNV1a_64 of the consolidated buffer
 }
 
 /**
@@ -213,8 +354,9 @@ static void wear_leveling_clear_cache(void) {
 static wear_leveling_status_t wear_leveling_read_consolidated(void) {
     wl_dprintf("Reading consolidated data\n");
 
+    const uint32_t         base   = wear_leveling_bank_base();
     wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
-    if (!backing_store_read_bulk(0, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
+    if (!backing_store_read_bulk(base, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
         wl_dprintf("Failed to read from backing store\n");
         status = WEAR_LEVELING_FAILED;
     }
@@ -224,13 +366,7 @@ static wear_leveling_status_t wear_leveling_read_consolidated(void) {
         uint64_t          expected = fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
         write_log_entry_t entry;
         wl_dprintf("Reading checksum\n");
-#if BACKING_STORE_WRITE_SIZE == 2
-        backing_store_read_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4);
-#elif BACKING_STORE_WRITE_SIZE == 4
-        backing_store_read_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2);
-#elif BACKING_STORE_WRITE_SIZE == 8
-        backing_store_read((WEAR_LEVELING_LOGICAL_SIZE) + 0, &entry.raw64);
-#endif
+        wear_leveling_read_record(base + (WEAR_LEVELING_LOGICAL_SIZE), &entry);
         // If we have a mismatch, clear the cache but do not flag a failure,
         // which will cater for the completely clean MCU case.
         if (entry.raw64 == expected) {
@@ -249,6 +385,198 @@ static wear_leveling_status_t wear_leveling_read_consolidated(void) {
     return status;
 }
 
+#ifdef WEAR_LEVELING_STATS
+/**
+ * Writes the statistics record of the bank at `base`, which includes the write log entries before `log_offset`.
+ */
+static bool wear_leveling_write_stats(uint32_t base, const wear_leveling_stats_t *stats, uint32_t log_offset) {
+    wear_leveling_stats_record_t record = {.stats = *stats, .log_offset = log_offset};
+#    ifdef WEAR_LEVELING_BANKED
+    record.bank1_erases = wear_leveling.bank1_erases;
+#    endif // WEAR_LEVELING_BANKED
+    record.check = fnv_32a_buf(&record, offsetof(wear_leveling_stats_record_t, check), FNV1_32A_INIT);
+    wl_dprintf("Writing statistics\n");
+    return backing_store_write_bulk(base + (WEAR_LEVELING_LOG_START) - (WEAR_LEVELING_STATS_RECORD_SIZE), record.raw, sizeof(record.raw) / sizeof(backing_store_int_t));
+}
+
+/**
+ * Reads the statistics record of the active bank, starting from zero if it is not valid.
+ */
+static void wear_leveling_read_stats(void) {
+    const uint32_t               base = wear_leveling_bank_base();
+    wear_leveling_stats_record_t record;
+    if (backing_store_read_bulk(base + (WEAR_LEVELING_LOG_START) - (WEAR_LEVELING_STATS_RECORD_SIZE), record.raw, sizeof(record.raw) / sizeof(backing_store_int_t)) && record.check == fnv_32a_buf(&record, offsetof(wear_leveling_stats_record_t, check), FNV1_32A_INIT) && record.log_offset >= (WEAR_LEVELING_LOG_START) && record.log_offset <= (WEAR_LEVELING_BANK_SIZE)) {
+        wear_leveling.stats             = record.stats;
+        wear_leveling.stats_replay_from = base + record.log_offset;
+#    ifdef WEAR_LEVELING_BANKED
+        wear_leveling.bank1_erases = record.bank1_erases;
+#    endif // WEAR_LEVELING_BANKED
+    } else {
+        wl_dprintf("No valid statistics, starting from zero\n");
+        memset(&wear_leveling.stats, 0, sizeof(wear_leveling.stats));
+        wear_leveling.stats_replay_from = base + (WEAR_LEVELING_LOG_START);
+#    ifdef WEAR_LEVELING_BANKED
+        wear_leveling.bank1_erases = 0;
+#    endif // WEAR_LEVELING_BANKED
+    }
+}
+#endif // WEAR_LEVELING_STATS
+
+/**
+ * Adds a played back write log entry to the statistics, unless the persisted statistics already include it.
+ */
+static inline void wear_leveling_stats_replayed(uint32_t entry_address, uint8_t type, uint32_t logical_bytes, uint32_t backing_bytes) {
+#ifdef WEAR_LEVELING_STATS
+    if (entry_address >= wear_leveling.stats_replay_from) {
+        wear_leveling.stats.entries[type] += 1;
+        wear_leveling.stats.logical_bytes += logical_bytes;
+        wear_leveling.stats.backing_bytes += backing_bytes;
+    }
+#endif // WEAR_LEVELING_STATS
+}
+
+#ifdef WEAR_LEVELING_BANKED
+/**
+ * Offset of the bank being consolidated into.
+ */
+static inline uint32_t wear_leveling_other_base(void) {
+    return wear_leveling.bank ? 0 : (WEAR_LEVELING_BANK_SIZE);
+}
+
+/**
+ * Starts a consolidation into the other bank, abandoning any that was in progress.
+ */
+static void wear_leveling_bank_start(void) {
+    wear_leveling.step     = BANK_STEP_ERASING;
+    wear_leveling.progress = 0;
+    wear_leveling.mirror   = false;
+}
+
+/**
+ * Performs a single step of the consolidation into the other bank.
+ * The other bank only becomes active once its commit record has been written, so a power loss at any point keeps the
+ * active bank as the newest committed one.
+ *
+ * @return WEAR_LEVELING_SUCCESS if further steps are required, WEAR_LEVELING_CONSOLIDATED once the other bank was committed
+ */
+static wear_leveling_status_t wear_leveling_bank_step(void) {
+    const uint32_t other = wear_leveling_other_base();
+
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        return WEAR_LEVELING_FAILED;
+    }
+
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    bool                   ok     = true;
+    switch (wear_leveling.step) {
+        case BANK_STEP_ERASING: {
+#ifdef WEAR_LEVELING_STATS
+            // Counted as soon as the bank starts being erased, an interrupted erase still wears the sectors it reached
+            if (wear_leveling.progress == 0) {
+                wear_leveling.stats.erases += 1;
+                wear_leveling.bank1_erases += wear_leveling.bank ^ 1;
+            }
+#endif // WEAR_LEVELING_STATS
+            wl_dprintf("Erasing bank at 0x%04X\n", (int)(other + wear_leveling.progress));
+            ok = backing_store_erase_range(other + wear_leveling.progress, (WEAR_LEVELING_BANK_ERASE_SIZE));
+            wear_leveling.progress += (WEAR_LEVELING_BANK_ERASE_SIZE);
+            if (wear_leveling.progress >= (WEAR_LEVELING_BANK_SIZE)) {
+                wear_leveling.step           = BANK_STEP_COPYING;
+                wear_leveling.progress       = 0;
+                wear_leveling.hash           = FNV1A_64_INIT;
+                wear_leveling.mirror_address = other + (WEAR_LEVELING_LOG_START);
+            }
+        } break;
+
+        case BANK_STEP_COPYING: {
+            uint32_t length = (WEAR_LEVELING_LOGICAL_SIZE) - wear_leveling.progress;
+            if (length > (WEAR_LEVELING_BANK_COPY_SIZE)) {
+                length = (WEAR_LEVELING_BANK_COPY_SIZE);
+            }
+            wl_dprintf("Copying consolidated data at 0x%04X\n", (int)(other + wear_leveling.progress));
+            wear_leveling.hash = fnv_64a_buf(&wear_leveling.cache[wear_leveling.progress], length, wear_leveling.hash);
+            ok                 = backing_store_write_bulk(other + wear_leveling.progress, (backing_store_int_t *)&wear_leveling.cache[wear_leveling.progress], length / sizeof(backing_store_int_t));
+            wear_leveling.progress += length;
+            wl_stats_add(backing_bytes, length);
+            if (wear_leveling.progress >= (WEAR_LEVELING_LOGICAL_SIZE)) {
+                wear_leveling.step = BANK_STEP_HASH;
+            }
+        } break;
+
+        case BANK_STEP_HASH: {
+            write_log_entry_t entry = {.raw64 = wear_leveling.hash};
+            wl_dprintf("Writing checksum\n");
+            ok                 = wear_leveling_write_record(other + (WEAR_LEVELING_LOGICAL_SIZE), &entry);
+            wear_leveling.step = BANK_STEP_COMMIT;
+            wl_stats_add(backing_bytes, 8);
+        } break;
+
+        case BANK_STEP_COMMIT: {
+#ifdef WEAR_LEVELING_STATS
+            // Statistics ahead of the commit record, including the entries already appended to the other bank's write log
+            wl_stats_add(backing_bytes, (WEAR_LEVELING_STATS_RECORD_SIZE) + 8);
+            wear_leveling_stats_t stats = wear_leveling.stats;
+            stats.consolidations += 1;
+            ok = wear_leveling_write_stats(other, &stats, wear_leveling.mirror_address - other);
+            if (!ok) {
+                break;
+            }
+#endif // WEAR_LEVELING_STATS
+            // Sequence first, magic last -- a partially written record is never considered committed
+            write_log_entry_t entry = {.raw32 = {wear_leveling.sequence + 1, WEAR_LEVELING_BANK_MAGIC}};
+            wl_dprintf("Committing bank, sequence %d\n", (int)(wear_leveling.sequence + 1));
+            ok = wear_leveling_write_record(other + (WEAR_LEVELING_LOGICAL_SIZE) + 8, &entry);
+            if (ok) {
+                wear_leveling.bank ^= 1;
+                wear_leveling.sequence += 1;
+                wear_leveling.write_address = wear_leveling.mirror_address;
+                wear_leveling.step          = BANK_STEP_IDLE;
+                wear_leveling.mirror        = false;
+                status                      = WEAR_LEVELING_CONSOLIDATED;
+                wl_stats_add(consolidations, 1);
+            }
+        } break;
+
+        default:
+            break;
+    }
+
+    if (!ok) {
+        // Restarted from the erase the next time consolidation is needed
+        wl_dprintf("Failed to consolidate into the other bank\n");
+        wear_leveling.step   = BANK_STEP_IDLE;
+        wear_leveling.mirror = false;
+        status               = WEAR_LEVELING_FAILED;
+    }
+
+    if (lock_status == STATUS_SUCCESS) {
+        if (wear_leveling_lock() == STATUS_FAILURE) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * Forces a write of the current cache.
+ * Consolidates into the other bank from scratch in a single call, the active bank is left intact until the other bank
+ * has been committed.
+ */
+static wear_leveling_status_t wear_leveling_consolidate_force(void) {
+    wl_dprintf("Consolidating into the other bank\n");
+
+    wear_leveling_bank_start();
+    wear_leveling_status_t status;
+    do {
+        status = wear_leveling_bank_step();
+    } while (status == WEAR_LEVELING_SUCCESS);
+
+    return status;
+}
+#else  // WEAR_LEVELING_BANKED
 /**
  * Writes the current cache to consolidated data at the beginning of the backing store.
  * Does not clear the write log.
@@ -263,32 +591,29 @@ static wear_leveling_status_t wear_leveling_write_consolidated(void) {
         wl_dprintf("Failed to write to backing store\n");
         status = WEAR_LEVELING_FAILED;
     }
+    wl_stats_add(backing_bytes, (WEAR_LEVELING_LOGICAL_SIZE));
 
     if (status != WEAR_LEVELING_FAILED) {
         // Write out the FNV1a_64 result of the consolidated data
         write_log_entry_t entry;
         entry.raw64 = fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
         wl_dprintf("Writing checksum\n");
-        do {
-#if BACKING_STORE_WRITE_SIZE == 2
-            if (!backing_store_write_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4)) {
-                status = WEAR_LEVELING_FAILED;
-                break;
-            }
-#elif BACKING_STORE_WRITE_SIZE == 4
-            if (!backing_store_write_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2)) {
-                status = WEAR_LEVELING_FAILED;
-                break;
-            }
-#elif BACKING_STORE_WRITE_SIZE == 8
-            if (!backing_store_write((WEAR_LEVELING_LOGICAL_SIZE), entry.raw64)) {
-                status = WEAR_LEVELING_FAILED;
-                break;
-            }
-#endif
-        } while (0);
+        if (!wear_leveling_write_record((WEAR_LEVELING_LOGICAL_SIZE), &entry)) {
+            status = WEAR_LEVELING_FAILED;
+        }
+        wl_stats_add(backing_bytes, 8);
     }
 
+#ifdef WEAR_LEVELING_STATS
+    if (status != WEAR_LEVELING_FAILED) {
+        wl_stats_add(consolidations, 1);
+        wl_stats_add(backing_bytes, (WEAR_LEVELING_STATS_RECORD_SIZE));
+        if (!wear_leveling_write_stats(0, &wear_leveling.stats, (WEAR_LEVELING_LOG_START))) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+#endif // WEAR_LEVELING_STATS
+
     if (lock_status == STATUS_SUCCESS) {
         wear_leveling_lock();
     }
@@ -309,6 +634,7 @@ static wear_leveling_status_t wear_leveling_consolidate_force(void) {
         wl_dprintf("Failed to erase backing store\n");
         return WEAR_LEVELING_FAILED;
     }
+    wl_stats_add(erases, 1);
 
     // Write the cache to the first section of the backing store.
     wear_leveling_status_t status = wear_leveling_write_consolidated();
@@ -317,10 +643,11 @@ static wear_leveling_status_t wear_leveling_consolidate_force(void) {
     }
 
     // Next write of the log occurs after the consolidated values at the start of the backing store.
-    wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
+    wear_leveling.write_address = (WEAR_LEVELING_LOG_START); // skips the FNV1a_64 of the consolidated area
 
     return status;
 }
+#endif // WEAR_LEVELING_BANKED
 
 /**
  * Potential write of the current cache to the backing store.
@@ -330,10 +657,18 @@ static wear_leveling_status_t wear_leveling_consolidate_force(void) {
  * @return true if consolidation occurred
  */
 static wear_leveling_status_t wear_leveling_consolidate_if_needed(void) {
-    if (wear_leveling.write_address >= (WEAR_LEVELING_BACKING_SIZE)) {
+    const uint32_t used = wear_leveling.write_address - wear_leveling_bank_base();
+    if (used >= (WEAR_LEVELING_BANK_SIZE)) {
         return wear_leveling_consolidate_force();
     }
 
+#ifdef WEAR_LEVELING_BANKED
+    // Start consolidating in the background once the write log is half full
+    if (wear_leveling.step == BANK_STEP_IDLE && used >= (WEAR_LEVELING_LOG_START) + ((WEAR_LEVELING_BANK_SIZE) - (WEAR_LEVELING_LOG_START)) / 2) {
+        wear_leveling_bank_start();
+    }
+#endif // WEAR_LEVELING_BANKED
+
     return WEAR_LEVELING_SUCCESS;
 }
 
@@ -343,12 +678,34 @@ static wear_leveling_status_t wear_leveling_consolidate_if_needed(void) {
  * @return true if consolidation occurred
  */
 static wear_leveling_status_t wear_leveling_append_raw(backing_store_int_t value) {
+#ifdef WEAR_LEVELING_BANKED
+    // A previously failed in-line consolidation leaves the active write log full, the cache already holds this write
+    if (wear_leveling.write_address >= wear_leveling_bank_base() + (WEAR_LEVELING_BANK_SIZE)) {
+        return wear_leveling_consolidate_force();
+    }
+#endif // WEAR_LEVELING_BANKED
+
     bool ok = backing_store_write(wear_leveling.write_address, value);
     if (!ok) {
         wl_dprintf("Failed to write to backing store\n");
         return WEAR_LEVELING_FAILED;
     }
     wear_leveling.write_address += (BACKING_STORE_WRITE_SIZE);
+    wl_stats_add(backing_bytes, (BACKING_STORE_WRITE_SIZE));
+
+#ifdef WEAR_LEVELING_BANKED
+    if (wear_leveling.mirror) {
+        if (wear_leveling.mirror_address >= wear_leveling_other_base() + (WEAR_LEVELING_BANK_SIZE) || !backing_store_write(wear_leveling.mirror_address, value)) {
+            // The other bank can no longer be kept up to date, start over with the current cache
+            wl_dprintf("Failed to append to the other bank's write log\n");
+            wear_leveling_bank_start();
+        } else {
+            wear_leveling.mirror_address += (BACKING_STORE_WRITE_SIZE);
+            wl_stats_add(backing_bytes, (BACKING_STORE_WRITE_SIZE));
+        }
+    }
+#endif // WEAR_LEVELING_BANKED
+
     return wear_leveling_consolidate_if_needed();
 }
 
@@ -363,6 +720,7 @@ static wear_leveling_status_t wear_leveling_write_raw_multibyte(uint32_t address
     for (size_t i = 0; i < length; ++i) {
         log.raw8[3 + i] = p[i];
     }
+    wl_stats_add(entries[LOG_ENTRY_TYPE_MULTIBYTE], 1);
 
     // Write to the backing store. See the multi-byte log format in the documentation header at the top of the file.
     wear_leveling_status_t status;
@@ -425,7 +783,8 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
             const uint16_t v = ((uint16_t)p[1]) << 8 | p[0]; // don't just dereference a uint16_t here -- if unaligned it generates faults on some MCUs
             if (v == 0 || v == 1) {
                 const write_log_entry_t log = LOG_ENTRY_MAKE_WORD_01(address, v);
-                status                      = wear_leveling_append_raw(log.raw16[0]);
+                wl_stats_add(entries[LOG_ENTRY_TYPE_WORD_01], 1);
+                status = wear_leveling_append_raw(log.raw16[0]);
                 if (status != WEAR_LEVELING_SUCCESS) {
                     // If consolidation occurred, then the cache has already been written to the consolidated area. No need to continue.
                     // If a failure occurred, pass it on.
@@ -442,7 +801,8 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
         // Small-write optimizations - address<64:
         if (address < 64) {
             const write_log_entry_t log = LOG_ENTRY_MAKE_OPTIMIZED_64(address, *p);
-            status                      = wear_leveling_append_raw(log.raw16[0]);
+            wl_stats_add(entries[LOG_ENTRY_TYPE_OPTIMIZED_64], 1);
+            status = wear_leveling_append_raw(log.raw16[0]);
             if (status != WEAR_LEVELING_SUCCESS) {
                 // If consolidation occurred, then the cache has already been written to the consolidated area. No need to continue.
                 // If a failure occurred, pass it on.
@@ -470,18 +830,57 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
     return status;
 }
 
+/**
+ * Buffered reader for the write log, fetching WEAR_LEVELING_PLAYBACK_BUFFER_SIZE bytes per backing store read.
+ */
+typedef struct wear_leveling_log_reader_t {
+    uint32_t            address; // Backing store address of the first buffered item
+    uint32_t            end;     // End of the write log
+    size_t              count;   // Number of buffered items
+    backing_store_int_t buffer[(WEAR_LEVELING_PLAYBACK_BUFFER_SIZE) / sizeof(backing_store_int_t)];
+} wear_leveling_log_reader_t;
+
+/**
+ * Reads a single item of the write log, refilling the buffer from the backing store as required.
+ */
+static bool wear_leveling_log_read(wear_leveling_log_reader_t *reader, uint32_t address, backing_store_int_t *value) {
+    if (address < reader->address || address >= reader->address + reader->count * (BACKING_STORE_WRITE_SIZE)) {
+        if (address >= reader->end) {
+            // Trailing parts of a truncated entry, outside of the write log
+            reader->count = 0;
+            return backing_store_read(address, value);
+        }
+
+        size_t count = (reader->end - address) / (BACKING_STORE_WRITE_SIZE);
+        if (count > sizeof(reader->buffer) / sizeof(backing_store_int_t)) {
+            count = sizeof(reader->buffer) / sizeof(backing_store_int_t);
+        }
+        reader->address = address;
+        reader->count   = 0;
+        if (!backing_store_read_bulk(address, reader->buffer, count)) {
+            return false;
+        }
+        reader->count = count;
+    }
+
+    *value = reader->buffer[(address - reader->address) / (BACKING_STORE_WRITE_SIZE)];
+    return true;
+}
+
 /**
  * "Replays" the write log from the backing store, updating the local cache with updated values.
  */
 static wear_leveling_status_t wear_leveling_playback_log(void) {
     wl_dprintf("Playback write log\n");
 
-    wear_leveling_status_t status          = WEAR_LEVELING_SUCCESS;
-    bool                   cancel_playback = false;
-    uint32_t               address         = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
-    while (!cancel_playback && address < (WEAR_LEVELING_BACKING_SIZE)) {
+    wear_leveling_status_t     status          = WEAR_LEVELING_SUCCESS;
+    bool                       cancel_playback = false;
+    uint32_t                   address         = wear_leveling_bank_base() + (WEAR_LEVELING_LOG_START); // skips the FNV1a_64 of the consolidated area
+    wear_leveling_log_reader_t reader          = {.end = wear_leveling_bank_base() + (WEAR_LEVELING_BANK_SIZE)};
+    while (!cancel_playback && address < reader.end) {
+        const uint32_t      entry_address = address;
         backing_store_int_t value;
-        bool                ok = backing_store_read(address, &value);
+        bool                ok = wear_leveling_log_read(&reader, address, &value);
         if (!ok) {
             wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
             cancel_playback = true;
@@ -510,7 +909,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
         switch (LOG_ENTRY_GET_TYPE(log)) {
             case LOG_ENTRY_TYPE_MULTIBYTE: {
 #if BACKING_STORE_WRITE_SIZE == 2
-                ok = backing_store_read(address, &log.raw16[1]);
+                ok = wear_leveling_log_read(&reader, address, &log.raw16[1]);
                 if (!ok) {
                     wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                     cancel_playback = true;
@@ -530,7 +929,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
 
 #if BACKING_STORE_WRITE_SIZE == 2
                 if (l > 1) {
-                    ok = backing_store_read(address, &log.raw16[2]);
+                    ok = wear_leveling_log_read(&reader, address, &log.raw16[2]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -540,7 +939,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                     address += (BACKING_STORE_WRITE_SIZE);
                 }
                 if (l > 3) {
-                    ok = backing_store_read(address, &log.raw16[3]);
+                    ok = wear_leveling_log_read(&reader, address, &log.raw16[3]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -551,7 +950,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                 }
 #elif BACKING_STORE_WRITE_SIZE == 4
                 if (l > 1) {
-                    ok = backing_store_read(address, &log.raw32[1]);
+                    ok = wear_leveling_log_read(&reader, address, &log.raw32[1]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -563,6 +962,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
 #endif
 
                 memcpy(&wear_leveling.cache[a], &log.raw8[3], l);
+                wear_leveling_stats_replayed(entry_address, LOG_ENTRY_TYPE_MULTIBYTE, l, address - entry_address);
             } break;
 #if BACKING_STORE_WRITE_SIZE == 2
             case LOG_ENTRY_TYPE_OPTIMIZED_64: {
@@ -576,6 +976,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                 }
 
                 wear_leveling.cache[a] = v;
+                wear_leveling_stats_replayed(entry_address, LOG_ENTRY_TYPE_OPTIMIZED_64, 1, (BACKING_STORE_WRITE_SIZE));
             } break;
             case LOG_ENTRY_TYPE_WORD_01: {
                 const uint32_t a = LOG_ENTRY_WORD_01_GET_ADDRESS(log);
@@ -589,6 +990,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
 
                 wear_leveling.cache[a + 0] = v;
                 wear_leveling.cache[a + 1] = 0;
+                wear_leveling_stats_replayed(entry_address, LOG_ENTRY_TYPE_WORD_01, 2, (BACKING_STORE_WRITE_SIZE));
             } break;
 #endif // BACKING_STORE_WRITE_SIZE == 2
             default: {
@@ -612,12 +1014,41 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
     return status;
 }
 
+#ifdef WEAR_LEVELING_BANKED
+/**
+ * Selects the committed bank with the highest sequence number, or the first bank if neither is committed.
+ */
+static void wear_leveling_select_bank(void) {
+    wear_leveling.bank     = 0;
+    wear_leveling.sequence = 0;
+    for (uint8_t bank = 0; bank < 2; ++bank) {
+        write_log_entry_t entry;
+        if (!wear_leveling_read_record(bank * (WEAR_LEVELING_BANK_SIZE) + (WEAR_LEVELING_LOGICAL_SIZE) + 8, &entry) || entry.raw32[1] != WEAR_LEVELING_BANK_MAGIC) {
+            continue;
+        }
+        if (wear_leveling.sequence == 0 || (int32_t)(entry.raw32[0] - wear_leveling.sequence) > 0) {
+            wear_leveling.bank     = bank;
+            wear_leveling.sequence = entry.raw32[0];
+        }
+    }
+    wl_dprintf("Using bank %d, sequence %d\n", (int)wear_leveling.bank, (int)wear_leveling.sequence);
+}
+#endif // WEAR_LEVELING_BANKED
+
 /**
  * Wear-leveling initialization
  */
 wear_leveling_status_t wear_leveling_init(void) {
     wl_dprintf("Init\n");
 
+#ifdef WEAR_LEVELING_BANKED
+    // Any consolidation interrupted by a reset is restarted from scratch
+    wear_leveling.bank     = 0;
+    wear_leveling.sequence = 0;
+    wear_leveling.step     = BANK_STEP_IDLE;
+    wear_leveling.mirror   = false;
+#endif // WEAR_LEVELING_BANKED
+
     // Reset the cache
     wear_leveling_clear_cache();
 
@@ -628,6 +1059,11 @@ wear_leveling_status_t wear_leveling_init(void) {
         return WEAR_LEVELING_FAILED;
     }
 
+#ifdef WEAR_LEVELING_BANKED
+    wear_leveling_select_bank();
+    wear_leveling_clear_cache();
+#endif // WEAR_LEVELING_BANKED
+
     // Read the previous consolidated values, then replay the existing write log so that the cache has the "live" values
     wear_leveling_status_t status = wear_leveling_read_consolidated();
     if (status == WEAR_LEVELING_FAILED) {
@@ -636,6 +1072,10 @@ wear_leveling_status_t wear_leveling_init(void) {
         return status;
     }
 
+#ifdef WEAR_LEVELING_STATS
+    wear_leveling_read_stats();
+#endif // WEAR_LEVELING_STATS
+
     status = wear_leveling_playback_log();
     if (status == WEAR_LEVELING_FAILED) {
         // If it failed, clear the cache and return with failure
@@ -662,8 +1102,29 @@ wear_leveling_status_t wear_leveling_erase(void) {
 
     // Perform the erase
     bool ret = backing_store_erase();
+#ifdef WEAR_LEVELING_BANKED
+    wear_leveling.bank     = 0;
+    wear_leveling.sequence = 0;
+    wear_leveling.step     = BANK_STEP_IDLE;
+    wear_leveling.mirror   = false;
+#endif // WEAR_LEVELING_BANKED
     wear_leveling_clear_cache();
 
+#ifdef WEAR_LEVELING_STATS
+    // Carry the statistics over to the erased backing store
+    if (ret) {
+#    ifdef WEAR_LEVELING_BANKED
+        // Both banks were erased
+        wear_leveling.stats.erases += 2;
+        wear_leveling.bank1_erases += 1;
+#    else
+        wl_stats_add(erases, 1);
+#    endif // WEAR_LEVELING_BANKED
+        wl_stats_add(backing_bytes, (WEAR_LEVELING_STATS_RECORD_SIZE));
+        ret = wear_leveling_write_stats(0, &wear_leveling.stats, (WEAR_LEVELING_LOG_START));
+    }
+#endif // WEAR_LEVELING_STATS
+
     // Lock the backing store if we acquired the lock successfully
     if (lock_status == STATUS_SUCCESS) {
         ret &= (wear_leveling_lock() != STATUS_FAILURE);
@@ -691,6 +1152,7 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
 
     // Update the cache before writing to the backing store -- if we hit the end of the backing store during writes to the log then we'll force a consolidation in-line
     memcpy(&wear_leveling.cache[address], value, length);
+    wl_stats_add(logical_bytes, length);
 
     // Unlock the backing store
     backing_store_lock_status_t lock_status = wear_leveling_unlock();
@@ -699,8 +1161,16 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
         return WEAR_LEVELING_FAILED;
     }
 
+#ifdef WEAR_LEVELING_BANKED
+    // Logical data that has already been copied into the other bank needs to be logged there as well
+    wear_leveling.mirror = wear_leveling.step >= BANK_STEP_COPYING && address < wear_leveling.progress;
+#endif // WEAR_LEVELING_BANKED
+
     // Perform the actual write
     wear_leveling_status_t status = wear_leveling_write_raw(address, value, length);
+#ifdef WEAR_LEVELING_BANKED
+    wear_leveling.mirror = false;
+#endif // WEAR_LEVELING_BANKED
     switch (status) {
         case WEAR_LEVELING_CONSOLIDATED:
         case WEAR_LEVELING_FAILED:
@@ -727,6 +1197,58 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
     return status;
 }
 
+/**
+ * Advances any background consolidation by a single step.
+ */
+wear_leveling_status_t wear_leveling_task(void) {
+#ifdef WEAR_LEVELING_BANKED
+    if (wear_leveling.step != BANK_STEP_IDLE) {
+        return wear_leveling_bank_step();
+    }
+#endif // WEAR_LEVELING_BANKED
+    return WEAR_LEVELING_SUCCESS;
+}
+
+#ifdef WEAR_LEVELING_STATS
+/**
+ * Retrieves the write-amplification statistics.
+ */
+void wear_leveling_get_stats(wear_leveling_stats_t *stats) {
+    *stats = wear_leveling.stats;
+}
+
+/**
+ * Resets the write-amplification statistics.
+ */
+void wear_leveling_reset_stats(void) {
+    memset(&wear_leveling.stats, 0, sizeof(wear_leveling.stats));
+#    ifdef WEAR_LEVELING_BANKED
+    wear_leveling.bank1_erases = 0;
+#    endif // WEAR_LEVELING_BANKED
+}
+
+/**
+ * Projects the lifetime of the backing store from the write-amplification statistics.
+ */
+void wear_leveling_get_lifetime(wear_leveling_lifetime_t *lifetime) {
+#    ifdef WEAR_LEVELING_BANKED
+    // Every bank erase is counted, the most worn bank sets the lifetime
+    const uint32_t bank1_erases = wear_leveling.bank1_erases;
+    const uint32_t bank0_erases = wear_leveling.stats.erases - bank1_erases;
+    uint64_t       millicycles  = (uint64_t)(bank0_erases > bank1_erases ? bank0_erases : bank1_erases) * 1000;
+#    else
+    // Every consolidation erases the entire backing store, and is already counted as an erase
+    const uint64_t log_size    = (WEAR_LEVELING_BANK_SIZE) - (WEAR_LEVELING_LOG_START);
+    const uint64_t log_used    = wear_leveling.write_address - (WEAR_LEVELING_LOG_START);
+    uint64_t       millicycles = (uint64_t)wear_leveling.stats.erases * 1000 + log_used * 1000 / log_size;
+#    endif // WEAR_LEVELING_BANKED
+
+    lifetime->worn_millicycles        = (uint32_t)millicycles;
+    lifetime->used_permille           = (uint32_t)(millicycles / (WEAR_LEVELING_ENDURANCE));
+    lifetime->projected_logical_bytes = millicycles ? (uint64_t)wear_leveling.stats.logical_bytes * (WEAR_LEVELING_ENDURANCE) * 1000 / millicycles : 0;
+}
+#endif // WEAR_LEVELING_STATS
+
 /**
  * Reads logical data from the cache.
  */
@@ -52,3 +52,57 @@ wear_leveling_status_t wear_leveling_write(uint32_t address, const void* value,
  * @return Status of the request
  */
 wear_leveling_status_t wear_leveling_read(uint32_t address, void* value, size_t length);
+
+/**
+ * Wear-leveling background task.
+ *
+ * With WEAR_LEVELING_BANKED, advances any pending consolidation into the inactive bank by a single step, so that writes
+ * never have to wait for a full erase. Without it, this is a no-op.
+ *
+ * @return WEAR_LEVELING_CONSOLIDATED when this step committed the new bank, otherwise the status of the step
+ */
+wear_leveling_status_t wear_leveling_task(void);
+
+/**
+ * @typedef Write-amplification statistics, available with WEAR_LEVELING_STATS.
+ */
+typedef struct wear_leveling_stats_t {
+    uint32_t logical_bytes;  //< Logical bytes written, excluding writes which did not change any values
+    uint32_t entries[3];     //< Write log entries appended, by type: multi-byte, 2-byte address < 64, 2-byte word 0/1
+    uint32_t backing_bytes;  //< Bytes written to the backing store, including consolidation
+    uint32_t consolidations; //< Number of times the write log was consolidated
+    uint32_t erases;         //< Number of erasures of the entire backing store, or of either bank with WEAR_LEVELING_BANKED
+} wear_leveling_stats_t;
+
+/**
+ * @typedef Projected lifetime of the backing store, derived from the statistics and WEAR_LEVELING_ENDURANCE.
+ */
+typedef struct wear_leveling_lifetime_t {
+    uint32_t worn_millicycles;        //< Erase cycles consumed by the most worn part of the backing store, in thousandths
+    uint32_t used_permille;           //< Proportion of WEAR_LEVELING_ENDURANCE consumed, in thousandths
+    uint64_t projected_logical_bytes; //< Logical bytes that can be written before reaching WEAR_LEVELING_ENDURANCE at the current write amplification, 0 if unknown
+} wear_leveling_lifetime_t;
+
+/**
+ * Retrieves the write-amplification statistics.
+ *
+ * The statistics are persisted alongside the consolidated data, and are restored from the backing store during
+ * wear_leveling_init().
+ *
+ * @param stats[out] the statistics since the last reset
+ */
+void wear_leveling_get_stats(wear_leveling_stats_t* stats);
+
+/**
+ * Resets the write-amplification statistics.
+ *
+ * The cleared statistics are persisted at the next consolidation or erasure.
+ */
+void wear_leveling_reset_stats(void);
+
+/**
+ * Projects the lifetime of the backing store from the write-amplification statistics.
+ *
+ * @param lifetime[out] the projected lifetime
+ */
+void wear_leveling_get_lifetime(wear_leveling_lifetime_t* lifetime);
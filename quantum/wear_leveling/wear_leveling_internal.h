@@ -3,6 +3,7 @@
 #pragma once
 
 #include "compiler_support.h"
+#include "wear_leveling.h"
 
 #include <stdint.h>
 #include <string.h>
@@ -64,6 +65,42 @@ STATIC_ASSERT(WEAR_LEVELING_BACKING_SIZE >= (WEAR_LEVELING_LOGICAL_SIZE * 2), "T
 STATIC_ASSERT(WEAR_LEVELING_LOGICAL_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Logical size must be a multiple of write size");
 STATIC_ASSERT(WEAR_LEVELING_BACKING_SIZE % WEAR_LEVELING_LOGICAL_SIZE == 0, "Backing size must be a multiple of logical size");
 
+// Number of bytes of the write log fetched per backing store read during playback
+#ifndef WEAR_LEVELING_PLAYBACK_BUFFER_SIZE
+#    define WEAR_LEVELING_PLAYBACK_BUFFER_SIZE 64
+#endif
+STATIC_ASSERT(WEAR_LEVELING_PLAYBACK_BUFFER_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Playback buffer size must be a multiple of write size");
+
+#ifdef WEAR_LEVELING_STATS
+// Persisted statistics, stored immediately before the write log
+#    define WEAR_LEVELING_STATS_RECORD_SIZE 40
+#    ifndef WEAR_LEVELING_ENDURANCE
+#        define WEAR_LEVELING_ENDURANCE 10000
+#    endif
+#else
+#    define WEAR_LEVELING_STATS_RECORD_SIZE 0
+#endif // WEAR_LEVELING_STATS
+
+#ifdef WEAR_LEVELING_BANKED
+// Each bank holds its own consolidated data, FNV1a_64 hash, commit record and write log
+#    define WEAR_LEVELING_BANK_SIZE ((WEAR_LEVELING_BACKING_SIZE) / 2)
+#    define WEAR_LEVELING_LOG_START ((WEAR_LEVELING_LOGICAL_SIZE) + 16 + (WEAR_LEVELING_STATS_RECORD_SIZE))
+#    define WEAR_LEVELING_BANK_MAGIC 0x4B4E4257 // "WBNK"
+// Defaults to the sector size in the drivers that know it at compile time
+#    ifndef WEAR_LEVELING_BANK_ERASE_SIZE
+#        error WEAR_LEVELING_BANK_ERASE_SIZE was not set, it needs to be the sector size of the backing store.
+#    endif
+#    ifndef WEAR_LEVELING_BANK_COPY_SIZE
+#        define WEAR_LEVELING_BANK_COPY_SIZE 64
+#    endif
+STATIC_ASSERT(WEAR_LEVELING_BANK_SIZE >= (WEAR_LEVELING_LOGICAL_SIZE * 2), "Bank size must be at least twice the size of the logical size");
+STATIC_ASSERT(WEAR_LEVELING_BANK_SIZE % WEAR_LEVELING_BANK_ERASE_SIZE == 0, "Bank size must be a multiple of the bank erase size");
+STATIC_ASSERT(WEAR_LEVELING_BANK_COPY_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Bank copy size must be a multiple of write size");
+#else
+#    define WEAR_LEVELING_BANK_SIZE (WEAR_LEVELING_BACKING_SIZE)
+#    define WEAR_LEVELING_LOG_START ((WEAR_LEVELING_LOGICAL_SIZE) + 8 + (WEAR_LEVELING_STATS_RECORD_SIZE))
+#endif // WEAR_LEVELING_BANKED
+
 // Backing Store API, to be implemented elsewhere by flash driver etc.
 bool backing_store_init(void);
 bool backing_store_unlock(void);
@@ -73,6 +110,7 @@ bool backing_store_write_bulk(uint32_t address, backing_store_int_t* values, siz
 bool backing_store_lock(void);
 bool backing_store_read(uint32_t address, backing_store_int_t* value);
 bool backing_store_read_bulk(uint32_t address, backing_store_int_t* values, size_t item_count); // weak implementation already provided, optimized implementation can be implemented by driver
+bool backing_store_erase_range(uint32_t address, size_t length);                               // only required with WEAR_LEVELING_BANKED, range is aligned to WEAR_LEVELING_BANK_ERASE_SIZE
 
 /**
  * Helper type used to contain a write log entry.
@@ -86,6 +124,23 @@ typedef union write_log_entry_t {
 
 STATIC_ASSERT(sizeof(write_log_entry_t) == 8, "Wear leveling write log entry size was not 8");
 
+#ifdef WEAR_LEVELING_STATS
+/**
+ * Helper type used to contain the persisted statistics.
+ */
+typedef union wear_leveling_stats_record_t {
+    struct {
+        wear_leveling_stats_t stats;
+        uint32_t              log_offset; // Offset within the bank of the first write log entry not included in the statistics
+        uint32_t              bank1_erases; // Erasures of the second bank, with WEAR_LEVELING_BANKED
+        uint32_t              check; // FNV1a_32 of the preceding fields
+    };
+    backing_store_int_t raw[(WEAR_LEVELING_STATS_RECORD_SIZE) / sizeof(backing_store_int_t)];
+} wear_leveling_stats_record_t;
+
+STATIC_ASSERT(sizeof(wear_leveling_stats_record_t) == (WEAR_LEVELING_STATS_RECORD_SIZE), "Wear leveling statistics record size mismatch");
+#endif // WEAR_LEVELING_STATS
+
 /**
  * Log entry type discriminator.
  */
@@ -0,0 +1,74 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "wear_leveling_stats.h"
+#include "wear_leveling.h"
+#include "print.h"
+
+#ifdef WEAR_LEVELING_STATS
+
+void wear_leveling_print_stats(void) {
+    wear_leveling_stats_t    stats;
+    wear_leveling_lifetime_t lifetime;
+    wear_leveling_get_stats(&stats);
+    wear_leveling_get_lifetime(&lifetime);
+
+    // Write amplification in hundredths
+    const uint32_t amplification = stats.logical_bytes ? (uint32_t)((uint64_t)stats.backing_bytes * 100 / stats.logical_bytes) : 0;
+
+    xprintf("logical=%lu backing=%lu amplification=%lu.%02lu\n", (unsigned long)stats.logical_bytes, (unsigned long)stats.backing_bytes, (unsigned long)(amplification / 100), (unsigned long)(amplification % 100));
+    xprintf("entries: multibyte=%lu optimized_64=%lu word_01=%lu\n", (unsigned long)stats.entries[0], (unsigned long)stats.entries[1], (unsigned long)stats.entries[2]);
+    xprintf("consolidations=%lu erases=%lu\n", (unsigned long)stats.consolidations, (unsigned long)stats.erases);
+    xprintf("worn=%lu.%03lu cycles used=%lu.%lu%% projected=%lu kB\n", (unsigned long)(lifetime.worn_millicycles / 1000), (unsigned long)(lifetime.worn_millicycles % 1000), (unsigned long)(lifetime.used_permille / 10), (unsigned long)(lifetime.used_permille % 10), (unsigned long)(lifetime.projected_logical_bytes / 1024));
+}
+
+static void wear_leveling_write_u32(uint8_t *data, uint32_t value) {
+    data[0] = value & 0xFF;
+    data[1] = (value >> 8) & 0xFF;
+    data[2] = (value >> 16) & 0xFF;
+    data[3] = (value >> 24) & 0xFF;
+}
+
+bool wear_leveling_stats_raw_hid_receive(uint8_t *data, uint8_t length) {
+    if (length < 2 || data[0] != WEAR_LEVELING_RAW_HID_ID) {
+        return false;
+    }
+
+    switch (data[1]) {
+        case WEAR_LEVELING_RAW_HID_GET_STATS:
+            if (length >= 30) {
+                wear_leveling_stats_t stats;
+                wear_leveling_get_stats(&stats);
+                wear_leveling_write_u32(&data[2], stats.logical_bytes);
+                wear_leveling_write_u32(&data[6], stats.entries[0]);
+                wear_leveling_write_u32(&data[10], stats.entries[1]);
+                wear_leveling_write_u32(&data[14], stats.entries[2]);
+                wear_leveling_write_u32(&data[18], stats.backing_bytes);
+                wear_leveling_write_u32(&data[22], stats.consolidations);
+                wear_leveling_write_u32(&data[26], stats.erases);
+                return true;
+            }
+            break;
+
+        case WEAR_LEVELING_RAW_HID_GET_LIFETIME:
+            if (length >= 18) {
+                wear_leveling_lifetime_t lifetime;
+                wear_leveling_get_lifetime(&lifetime);
+                wear_leveling_write_u32(&data[2], lifetime.worn_millicycles);
+                wear_leveling_write_u32(&data[6], lifetime.used_permille);
+                wear_leveling_write_u32(&data[10], (uint32_t)lifetime.projected_logical_bytes);
+                wear_leveling_write_u32(&data[14], (uint32_t)(lifetime.projected_logical_bytes >> 32));
+                return true;
+            }
+            break;
+
+        case WEAR_LEVELING_RAW_HID_RESET:
+            wear_leveling_reset_stats();
+            return true;
+    }
+
+    // unknown command, or reply too long
+    data[1] = 0xFF;
+    return true;
+}
+
+#endif // WEAR_LEVELING_STATS
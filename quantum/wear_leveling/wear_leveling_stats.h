@@ -0,0 +1,46 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+    Reporting of the wear-leveling write-amplification statistics, enabled
+    with `#define WEAR_LEVELING_STATS` on a wear-leveling build.
+
+    Write amplification is backing_bytes / logical_bytes. The projected
+    lifetime assumes the rated WEAR_LEVELING_ENDURANCE of the backing store
+    and the write rate seen so far.
+*/
+
+#ifndef WEAR_LEVELING_RAW_HID_ID
+#    define WEAR_LEVELING_RAW_HID_ID 0xFC
+#endif
+
+enum wear_leveling_raw_hid_command {
+    WEAR_LEVELING_RAW_HID_GET_STATS    = 0x01,
+    WEAR_LEVELING_RAW_HID_GET_LIFETIME = 0x02,
+    WEAR_LEVELING_RAW_HID_RESET        = 0x03,
+};
+
+/**
+ * @brief Prints the statistics and the projected lifetime over the console.
+ */
+void wear_leveling_print_stats(void);
+
+/**
+ * @brief Handles wear-leveling requests received over raw HID, to be called
+ * from raw_hid_receive() or raw_hid_receive_kb().
+ *
+ * data[0] is WEAR_LEVELING_RAW_HID_ID and data[1] a
+ * wear_leveling_raw_hid_command. The reply is written back to data from
+ * data[2], as little endian values:
+ *
+ *  - GET_STATS: the wear_leveling_stats_t fields in order, 32 bits each
+ *  - GET_LIFETIME: worn_millicycles and used_permille, 32 bits each, then
+ *    projected_logical_bytes, 64 bits
+ *
+ * @return true The request was a wear-leveling request and data holds the reply
+ */
+bool wear_leveling_stats_raw_hid_receive(uint8_t *data, uint8_t length);
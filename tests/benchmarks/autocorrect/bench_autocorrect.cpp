@@ -0,0 +1,24 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "benchmark_fixture.hpp"
+
+class Autocorrect : public BenchmarkFixture {};
+
+TEST_F(Autocorrect, Typing) {
+    add_alpha_keys();
+    run_benchmark(type_text(BENCHMARK_TEXT));
+}
+
+TEST_F(Autocorrect, FastTyping) {
+    add_alpha_keys();
+    run_benchmark(type_text(BENCHMARK_TEXT, 5, 1));
+}
+
+TEST_F(Autocorrect, Corrections) {
+    add_alpha_keys();
+    // "fales" is corrected to "false" by the default dictionary
+    run_benchmark(type_text("fales "));
+}
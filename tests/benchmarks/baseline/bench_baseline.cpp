@@ -0,0 +1,23 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "benchmark_fixture.hpp"
+
+class Baseline : public BenchmarkFixture {};
+
+TEST_F(Baseline, Typing) {
+    add_alpha_keys();
+    run_benchmark(type_text(BENCHMARK_TEXT));
+}
+
+TEST_F(Baseline, FastTyping) {
+    add_alpha_keys();
+    run_benchmark(type_text(BENCHMARK_TEXT, 5, 1));
+}
+
+TEST_F(Baseline, Idle) {
+    add_alpha_keys();
+    run_benchmark({{alpha_position(' '), false, 1000}});
+}
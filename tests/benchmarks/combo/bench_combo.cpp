@@ -0,0 +1,30 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "benchmark_fixture.hpp"
+
+class Combo : public BenchmarkFixture {};
+
+TEST_F(Combo, Typing) {
+    add_alpha_keys();
+    run_benchmark(type_text(BENCHMARK_TEXT));
+}
+
+TEST_F(Combo, FastTyping) {
+    add_alpha_keys();
+    run_benchmark(type_text(BENCHMARK_TEXT, 5, 1));
+}
+
+TEST_F(Combo, Chords) {
+    add_alpha_keys();
+    // press "b" + "k" together, see bench_combos.c
+    std::vector<BenchmarkEvent> script = {
+        {alpha_position('b'), true, 1},
+        {alpha_position('k'), true, 30},
+        {alpha_position('b'), false, 1},
+        {alpha_position('k'), false, 30},
+    };
+    run_benchmark(script, 2000);
+}
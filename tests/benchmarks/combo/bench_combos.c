@@ -0,0 +1,105 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+// clang-format off
+uint16_t const combo_0[] = {KC_A, KC_D, KC_F, COMBO_END};
+uint16_t const combo_1[] = {KC_B, KC_K, COMBO_END};
+uint16_t const combo_2[] = {KC_C, KC_R, COMBO_END};
+uint16_t const combo_3[] = {KC_D, KC_Y, KC_M, COMBO_END};
+uint16_t const combo_4[] = {KC_E, KC_F, COMBO_END};
+uint16_t const combo_5[] = {KC_F, KC_M, COMBO_END};
+uint16_t const combo_6[] = {KC_G, KC_T, COMBO_END};
+uint16_t const combo_7[] = {KC_H, KC_A, COMBO_END};
+uint16_t const combo_8[] = {KC_I, KC_H, COMBO_END};
+uint16_t const combo_9[] = {KC_J, KC_O, KC_A, COMBO_END};
+uint16_t const combo_10[] = {KC_K, KC_V, COMBO_END};
+uint16_t const combo_11[] = {KC_L, KC_C, COMBO_END};
+uint16_t const combo_12[] = {KC_M, KC_J, KC_H, COMBO_END};
+uint16_t const combo_13[] = {KC_N, KC_Q, COMBO_END};
+uint16_t const combo_14[] = {KC_O, KC_X, COMBO_END};
+uint16_t const combo_15[] = {KC_P, KC_E, KC_O, COMBO_END};
+uint16_t const combo_16[] = {KC_Q, KC_L, COMBO_END};
+uint16_t const combo_17[] = {KC_R, KC_S, COMBO_END};
+uint16_t const combo_18[] = {KC_S, KC_Z, KC_V, COMBO_END};
+uint16_t const combo_19[] = {KC_U, KC_N, COMBO_END};
+uint16_t const combo_20[] = {KC_V, KC_U, KC_C, COMBO_END};
+uint16_t const combo_21[] = {KC_W, KC_B, COMBO_END};
+uint16_t const combo_22[] = {KC_X, KC_I, COMBO_END};
+uint16_t const combo_23[] = {KC_Y, KC_P, KC_J, COMBO_END};
+uint16_t const combo_24[] = {KC_Z, KC_W, COMBO_END};
+uint16_t const combo_25[] = {KC_A, KC_D, COMBO_END};
+uint16_t const combo_26[] = {KC_B, KC_K, KC_Q, COMBO_END};
+uint16_t const combo_27[] = {KC_D, KC_Y, COMBO_END};
+uint16_t const combo_28[] = {KC_E, KC_F, KC_X, COMBO_END};
+uint16_t const combo_29[] = {KC_H, KC_A, KC_E, COMBO_END};
+uint16_t const combo_30[] = {KC_J, KC_O, COMBO_END};
+uint16_t const combo_31[] = {KC_K, KC_V, KC_L, COMBO_END};
+uint16_t const combo_32[] = {KC_M, KC_J, COMBO_END};
+uint16_t const combo_33[] = {KC_N, KC_Q, KC_S, COMBO_END};
+uint16_t const combo_34[] = {KC_P, KC_E, COMBO_END};
+uint16_t const combo_35[] = {KC_Q, KC_L, KC_Z, COMBO_END};
+uint16_t const combo_36[] = {KC_S, KC_Z, COMBO_END};
+uint16_t const combo_37[] = {KC_V, KC_U, COMBO_END};
+uint16_t const combo_38[] = {KC_W, KC_B, KC_N, COMBO_END};
+uint16_t const combo_39[] = {KC_Y, KC_P, COMBO_END};
+uint16_t const combo_40[] = {KC_Z, KC_W, KC_U, COMBO_END};
+uint16_t const combo_41[] = {KC_C, KC_R, KC_B, COMBO_END};
+uint16_t const combo_42[] = {KC_F, KC_M, KC_I, COMBO_END};
+uint16_t const combo_43[] = {KC_I, KC_H, KC_P, COMBO_END};
+uint16_t const combo_44[] = {KC_L, KC_C, KC_W, COMBO_END};
+uint16_t const combo_45[] = {KC_O, KC_X, KC_D, COMBO_END};
+uint16_t const combo_46[] = {KC_R, KC_S, KC_K, COMBO_END};
+uint16_t const combo_47[] = {KC_U, KC_N, KC_R, COMBO_END};
+
+combo_t key_combos[] = {
+    COMBO(combo_0, KC_F1),
+    COMBO(combo_1, KC_F2),
+    COMBO(combo_2, KC_F3),
+    COMBO(combo_3, KC_F4),
+    COMBO(combo_4, KC_F5),
+    COMBO(combo_5, KC_F6),
+    COMBO(combo_6, KC_F7),
+    COMBO(combo_7, KC_F8),
+    COMBO(combo_8, KC_F9),
+    COMBO(combo_9, KC_F10),
+    COMBO(combo_10, KC_F11),
+    COMBO(combo_11, KC_F12),
+    COMBO(combo_12, KC_F1),
+    COMBO(combo_13, KC_F2),
+    COMBO(combo_14, KC_F3),
+    COMBO(combo_15, KC_F4),
+    COMBO(combo_16, KC_F5),
+    COMBO(combo_17, KC_F6),
+    COMBO(combo_18, KC_F7),
+    COMBO(combo_19, KC_F8),
+    COMBO(combo_20, KC_F9),
+    COMBO(combo_21, KC_F10),
+    COMBO(combo_22, KC_F11),
+    COMBO(combo_23, KC_F12),
+    COMBO(combo_24, KC_F1),
+    COMBO(combo_25, KC_F2),
+    COMBO(combo_26, KC_F3),
+    COMBO(combo_27, KC_F4),
+    COMBO(combo_28, KC_F5),
+    COMBO(combo_29, KC_F6),
+    COMBO(combo_30, KC_F7),
+    COMBO(combo_31, KC_F8),
+    COMBO(combo_32, KC_F9),
+    COMBO(combo_33, KC_F10),
+    COMBO(combo_34, KC_F11),
+    COMBO(combo_35, KC_F12),
+    COMBO(combo_36, KC_F1),
+    COMBO(combo_37, KC_F2),
+    COMBO(combo_38, KC_F3),
+    COMBO(combo_39, KC_F4),
+    COMBO(combo_40, KC_F5),
+    COMBO(combo_41, KC_F6),
+    COMBO(combo_42, KC_F7),
+    COMBO(combo_43, KC_F8),
+    COMBO(combo_44, KC_F9),
+    COMBO(combo_45, KC_F10),
+    COMBO(combo_46, KC_F11),
+    COMBO(combo_47, KC_F12)
+};
+// clang-format on
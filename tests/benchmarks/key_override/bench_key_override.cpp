@@ -0,0 +1,22 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "benchmark_fixture.hpp"
+
+class KeyOverride : public BenchmarkFixture {};
+
+TEST_F(KeyOverride, Typing) {
+    add_alpha_keys();
+    run_benchmark(type_text(BENCHMARK_TEXT));
+}
+
+TEST_F(KeyOverride, ShiftedTyping) {
+    add_alpha_keys();
+    add_key(KeymapKey(0, 9, 3, KC_LEFT_SHIFT));
+    std::vector<BenchmarkEvent> script = type_text(BENCHMARK_TEXT);
+    script.insert(script.begin(), {{.col = 9, .row = 3}, true, 30});
+    script.push_back({{.col = 9, .row = 3}, false, 30});
+    run_benchmark(script);
+}
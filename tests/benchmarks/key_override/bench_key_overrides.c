@@ -0,0 +1,17 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+const key_override_t a_override     = ko_make_basic(MOD_MASK_SHIFT, KC_A, KC_1);
+const key_override_t e_override     = ko_make_basic(MOD_MASK_SHIFT, KC_E, KC_2);
+const key_override_t o_override     = ko_make_basic(MOD_MASK_CTRL, KC_O, KC_3);
+const key_override_t space_override = ko_make_basic(MOD_MASK_SHIFT, KC_SPACE, KC_TAB);
+
+// clang-format off
+const key_override_t *key_overrides[] = {
+    &a_override,
+    &e_override,
+    &o_override,
+    &space_override
+};
+// clang-format on
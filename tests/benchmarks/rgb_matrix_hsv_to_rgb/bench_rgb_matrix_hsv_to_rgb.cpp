@@ -0,0 +1,147 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <vector>
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "benchmark_fixture.hpp"
+
+extern "C" {
+#include "color.h"
+}
+
+// The per-LED conversion as it was before the batched kernel, kept as the baseline.
+static rgb_t reference_hsv_to_rgb(hsv_t hsv) {
+    rgb_t    rgb;
+    uint8_t  region, remainder, p, q, t;
+    uint16_t h = hsv.h, s = hsv.s, v = hsv.v;
+
+    if (s == 0) {
+        rgb.r = rgb.g = rgb.b = v;
+        return rgb;
+    }
+
+    region    = h * 6 / 255;
+    remainder = (h * 2 - region * 85) * 3;
+
+    p = (v * (255 - s)) >> 8;
+    q = (v * (255 - ((s * remainder) >> 8))) >> 8;
+    t = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
+
+    switch (region) {
+        case 6:
+        case 0:
+            rgb = {(uint8_t)v, t, p};
+            break;
+        case 1:
+            rgb = {q, (uint8_t)v, p};
+            break;
+        case 2:
+            rgb = {p, (uint8_t)v, t};
+            break;
+        case 3:
+            rgb = {p, q, (uint8_t)v};
+            break;
+        case 4:
+            rgb = {t, p, (uint8_t)v};
+            break;
+        default:
+            rgb = {(uint8_t)v, p, q};
+            break;
+    }
+    return rgb;
+}
+
+class RgbMatrixHsvToRgb : public BenchmarkFixture {
+   public:
+    // Every hue and saturation at a few brightness levels, in LED sized chunks.
+    static std::vector<hsv_t> all_colors() {
+        std::vector<hsv_t> colors;
+        for (unsigned v = 0; v < 256; v += 51) {
+            for (unsigned h = 0; h < 256; h++) {
+                for (unsigned s = 0; s < 256; s++) {
+                    colors.push_back({(uint8_t)h, (uint8_t)s, (uint8_t)v});
+                }
+            }
+        }
+        return colors;
+    }
+
+    // Animates the effect for 40s, the key events only drive keyboard_task().
+    void run_effect() {
+        add_alpha_keys();
+        run_benchmark(type_text("a", 1000, 1000), 20);
+    }
+
+    template <typename F>
+    void run_conversion(const char* name, F convert, unsigned iterations = 20) {
+        const std::vector<hsv_t> colors = all_colors();
+        std::vector<rgb_t>       rgb(colors.size());
+
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned i = 0; i < iterations; i++) {
+            convert(colors, rgb);
+        }
+        uint64_t elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+        if (elapsed_ns == 0) {
+            elapsed_ns = 1;
+        }
+
+        const uint64_t leds        = (uint64_t)colors.size() * iterations;
+        const uint64_t leds_per_ms = leds * 1000000ULL / elapsed_ns;
+        uint32_t       checksum    = 0;
+        for (const rgb_t& color : rgb) {
+            checksum = checksum * 31 + (color.r << 16 | color.g << 8 | color.b);
+        }
+
+        RecordProperty("leds", (int64_t)leds);
+        RecordProperty("leds_per_ms", (int64_t)leds_per_ms);
+        printf("RgbMatrixHsvToRgb.%s: leds=%llu leds_per_ms=%llu checksum=%08x\n", name, (unsigned long long)leds, (unsigned long long)leds_per_ms, (unsigned)checksum);
+    }
+};
+
+TEST_F(RgbMatrixHsvToRgb, ReferencePerLed) {
+    run_conversion("ReferencePerLed", [](const std::vector<hsv_t>& hsv, std::vector<rgb_t>& rgb) {
+        for (size_t i = 0; i < hsv.size(); i++) {
+            rgb[i] = reference_hsv_to_rgb(hsv[i]);
+        }
+    });
+}
+
+TEST_F(RgbMatrixHsvToRgb, PerLed) {
+    run_conversion("PerLed", [](const std::vector<hsv_t>& hsv, std::vector<rgb_t>& rgb) {
+        for (size_t i = 0; i < hsv.size(); i++) {
+            rgb[i] = hsv_to_rgb_nocie(hsv[i]);
+        }
+    });
+}
+
+TEST_F(RgbMatrixHsvToRgb, Batch) {
+    run_conversion("Batch", [](const std::vector<hsv_t>& hsv, std::vector<rgb_t>& rgb) {
+        for (size_t i = 0; i < hsv.size(); i += 16) {
+            hsv_to_rgb_batch_nocie(&hsv[i], &rgb[i], 16);
+        }
+    });
+}
+
+TEST_F(RgbMatrixHsvToRgb, CycleLeftRight) {
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_CYCLE_LEFT_RIGHT);
+    run_effect();
+}
+
+TEST_F(RgbMatrixHsvToRgb, CycleSpiral) {
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_CYCLE_SPIRAL);
+    run_effect();
+}
+
+TEST_F(RgbMatrixHsvToRgb, CycleOutInDual) {
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_CYCLE_OUT_IN_DUAL);
+    run_effect();
+}
+
+TEST_F(RgbMatrixHsvToRgb, RainbowBeacon) {
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_RAINBOW_BEACON);
+    run_effect();
+}
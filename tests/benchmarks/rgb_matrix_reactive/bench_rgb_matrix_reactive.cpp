@@ -0,0 +1,26 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "benchmark_fixture.hpp"
+
+class RgbMatrixReactive : public BenchmarkFixture {};
+
+TEST_F(RgbMatrixReactive, SolidReactiveSimple) {
+    add_alpha_keys();
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_REACTIVE_SIMPLE);
+    run_benchmark(type_text(BENCHMARK_TEXT));
+}
+
+TEST_F(RgbMatrixReactive, Splash) {
+    add_alpha_keys();
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_SPLASH);
+    run_benchmark(type_text(BENCHMARK_TEXT));
+}
+
+TEST_F(RgbMatrixReactive, Multisplash) {
+    add_alpha_keys();
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_MULTISPLASH);
+    run_benchmark(type_text(BENCHMARK_TEXT, 5, 1));
+}
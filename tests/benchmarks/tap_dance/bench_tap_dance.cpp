@@ -0,0 +1,18 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "benchmark_fixture.hpp"
+
+class TapDance : public BenchmarkFixture {};
+
+TEST_F(TapDance, Typing) {
+    add_alpha_keys({{'e', TD(0)}, {'t', TD(1)}, {'o', TD(2)}, {' ', TD(3)}});
+    run_benchmark(type_text(BENCHMARK_TEXT));
+}
+
+TEST_F(TapDance, FastTyping) {
+    add_alpha_keys({{'e', TD(0)}, {'t', TD(1)}, {'o', TD(2)}, {' ', TD(3)}});
+    run_benchmark(type_text(BENCHMARK_TEXT, 5, 1));
+}
@@ -0,0 +1,12 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+enum tap_dances { TD_E, TD_T, TD_O, TD_SPC };
+
+tap_dance_action_t tap_dance_actions[] = {
+    [TD_E]   = ACTION_TAP_DANCE_DOUBLE(KC_E, KC_ESC),
+    [TD_T]   = ACTION_TAP_DANCE_DOUBLE(KC_T, KC_TAB),
+    [TD_O]   = ACTION_TAP_DANCE_DOUBLE(KC_O, KC_ENTER),
+    [TD_SPC] = ACTION_TAP_DANCE_DOUBLE(KC_SPACE, KC_BACKSPACE),
+};
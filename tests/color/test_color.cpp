@@ -0,0 +1,100 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "color.h"
+}
+
+// The per-LED conversion as it was before the batched kernel.
+static rgb_t reference_hsv_to_rgb(hsv_t hsv) {
+    rgb_t    rgb;
+    uint8_t  region, remainder, p, q, t;
+    uint16_t h = hsv.h, s = hsv.s, v = hsv.v;
+
+    if (s == 0) {
+        rgb.r = rgb.g = rgb.b = v;
+        return rgb;
+    }
+
+    region    = h * 6 / 255;
+    remainder = (h * 2 - region * 85) * 3;
+
+    p = (v * (255 - s)) >> 8;
+    q = (v * (255 - ((s * remainder) >> 8))) >> 8;
+    t = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
+
+    switch (region) {
+        case 6:
+        case 0:
+            rgb = {(uint8_t)v, t, p};
+            break;
+        case 1:
+            rgb = {q, (uint8_t)v, p};
+            break;
+        case 2:
+            rgb = {p, (uint8_t)v, t};
+            break;
+        case 3:
+            rgb = {p, q, (uint8_t)v};
+            break;
+        case 4:
+            rgb = {t, p, (uint8_t)v};
+            break;
+        default:
+            rgb = {(uint8_t)v, p, q};
+            break;
+    }
+    return rgb;
+}
+
+class Color : public ::testing::Test {
+   public:
+    // Every hue and saturation at a few brightness levels.
+    static std::vector<hsv_t> all_colors() {
+        std::vector<hsv_t> colors;
+        for (unsigned v = 0; v < 256; v += 51) {
+            for (unsigned h = 0; h < 256; h++) {
+                for (unsigned s = 0; s < 256; s++) {
+                    colors.push_back({(uint8_t)h, (uint8_t)s, (uint8_t)v});
+                }
+            }
+        }
+        return colors;
+    }
+};
+
+TEST_F(Color, BatchMatchesReference) {
+    const std::vector<hsv_t> colors = all_colors();
+    std::vector<rgb_t>       rgb(colors.size());
+
+    for (size_t i = 0; i < colors.size(); i += 16) {
+        hsv_to_rgb_batch_nocie(&colors[i], &rgb[i], 16);
+    }
+    for (size_t i = 0; i < colors.size(); i++) {
+        rgb_t expected = reference_hsv_to_rgb(colors[i]);
+        ASSERT_EQ(rgb[i].r, expected.r) << "h=" << +colors[i].h << " s=" << +colors[i].s << " v=" << +colors[i].v;
+        ASSERT_EQ(rgb[i].g, expected.g) << "h=" << +colors[i].h << " s=" << +colors[i].s << " v=" << +colors[i].v;
+        ASSERT_EQ(rgb[i].b, expected.b) << "h=" << +colors[i].h << " s=" << +colors[i].s << " v=" << +colors[i].v;
+    }
+}
+
+TEST_F(Color, BatchMatchesPerLed) {
+    const std::vector<hsv_t> colors = all_colors();
+    std::vector<rgb_t>       rgb(colors.size());
+
+    // Odd sized chunks, so the tail of the batch is covered as well.
+    for (size_t i = 0; i < colors.size(); i += 7) {
+        hsv_to_rgb_batch(&colors[i], &rgb[i], (uint8_t)std::min<size_t>(7, colors.size() - i));
+    }
+    for (size_t i = 0; i < colors.size(); i++) {
+        rgb_t expected = hsv_to_rgb(colors[i]);
+        ASSERT_EQ(rgb[i].r, expected.r) << "h=" << +colors[i].h << " s=" << +colors[i].s << " v=" << +colors[i].v;
+        ASSERT_EQ(rgb[i].g, expected.g) << "h=" << +colors[i].h << " s=" << +colors[i].s << " v=" << +colors[i].v;
+        ASSERT_EQ(rgb[i].b, expected.b) << "h=" << +colors[i].h << " s=" << +colors[i].s << " v=" << +colors[i].v;
+    }
+}
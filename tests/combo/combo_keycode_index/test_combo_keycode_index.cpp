@@ -0,0 +1,145 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <random>
+#include <vector>
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_driver.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "keymap_introspection.h"
+}
+
+using testing::_;
+using testing::InSequence;
+
+// Randomized combo set served through the weak combo_count()/combo_get()
+// hooks, falls back to key_combos when empty.
+static std::vector<std::vector<uint16_t>> random_keys;
+static std::vector<combo_t>               random_combos;
+
+extern "C" uint16_t combo_count(void) {
+    return random_combos.empty() ? combo_count_raw() : random_combos.size();
+}
+
+extern "C" combo_t* combo_get(uint16_t combo_idx) {
+    return random_combos.empty() ? combo_get_raw(combo_idx) : &random_combos[combo_idx];
+}
+
+class ComboKeycodeIndex : public TestFixture {
+   public:
+    void TearDown() override {
+        random_keys.clear();
+        random_combos.clear();
+        combo_keycode_index_rebuild();
+    }
+
+    void generate_combos(std::mt19937& rng, size_t count) {
+        std::uniform_int_distribution<uint16_t> keycode(KC_A, KC_L);
+        std::uniform_int_distribution<size_t>   length(2, 4);
+
+        random_keys.assign(count, {});
+        random_combos.assign(count, {});
+        for (size_t i = 0; i < count; ++i) {
+            size_t n = length(rng);
+            for (size_t k = 0; k < n; ++k) {
+                random_keys[i].push_back(keycode(rng));
+            }
+            random_keys[i].push_back(COMBO_END);
+            random_combos[i].keys    = random_keys[i].data();
+            random_combos[i].keycode = KC_SPACE;
+        }
+        combo_keycode_index_rebuild();
+    }
+
+    std::vector<uint16_t> linear_candidates(uint16_t keycode) {
+        std::vector<uint16_t> result;
+        for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+            for (const uint16_t* key = combo_get(idx)->keys; *key != COMBO_END; ++key) {
+                if (*key == keycode) {
+                    result.push_back(idx);
+                    break;
+                }
+            }
+        }
+        return result;
+    }
+
+    std::vector<uint16_t> indexed_candidates(uint16_t keycode) {
+        std::vector<uint16_t> result;
+        uint16_t              position, count;
+        EXPECT_TRUE(combo_keycode_index_find(keycode, &position, &count));
+        for (uint16_t i = 0; i < count; ++i) {
+            result.push_back(combo_keycode_index_get(position + i));
+        }
+        return result;
+    }
+};
+
+TEST_F(ComboKeycodeIndex, index_matches_linear_scan_for_randomized_combos) {
+    std::mt19937 rng(0xC0B0);
+
+    for (int iteration = 0; iteration < 100; ++iteration) {
+        // At most 4 keys per combo keeps 16 combos within COMBO_KEYCODE_INDEX_SIZE.
+        generate_combos(rng, 1 + iteration % 16);
+        for (uint16_t keycode = KC_NO; keycode <= KC_Z; ++keycode) {
+            EXPECT_EQ(indexed_candidates(keycode), linear_candidates(keycode)) << "iteration " << iteration << ", keycode " << keycode;
+        }
+    }
+}
+
+TEST_F(ComboKeycodeIndex, index_falls_back_to_linear_scan_on_overflow) {
+    std::mt19937 rng(0xC0B1);
+    uint16_t     position, count;
+
+    // 40 combos of at least 2 distinct keys exceed COMBO_KEYCODE_INDEX_SIZE.
+    generate_combos(rng, 40);
+    for (auto& keys : random_keys) {
+        keys[0] = KC_Y;
+        keys[1] = KC_Z;
+    }
+    combo_keycode_index_rebuild();
+    EXPECT_FALSE(combo_keycode_index_find(KC_A, &position, &count));
+}
+
+TEST_F(ComboKeycodeIndex, combo_tapped) {
+    TestDriver driver;
+    KeymapKey  key_y(0, 0, 1, KC_Y);
+    KeymapKey  key_u(0, 0, 2, KC_U);
+    set_keymap({key_y, key_u});
+
+    EXPECT_REPORT(driver, (KC_SPACE));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_y, key_u});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboKeycodeIndex, overlapping_combo_tapped) {
+    TestDriver driver;
+    KeymapKey  key_y(0, 0, 1, KC_Y);
+    KeymapKey  key_u(0, 0, 2, KC_U);
+    KeymapKey  key_i(0, 0, 3, KC_I);
+    set_keymap({key_y, key_u, key_i});
+
+    EXPECT_REPORT(driver, (KC_ENTER));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_y, key_u, key_i});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboKeycodeIndex, non_combo_key_passes_through) {
+    TestDriver driver;
+    KeymapKey  key_z(0, 0, 1, KC_Z);
+    KeymapKey  key_a(0, 0, 2, KC_A);
+    set_keymap({key_z, key_a});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,17 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+enum combos { modtest, osmshift, overlap };
+
+uint16_t const modtest_combo[]  = {KC_Y, KC_U, COMBO_END};
+uint16_t const osmshift_combo[] = {KC_Z, KC_X, COMBO_END};
+uint16_t const overlap_combo[]  = {KC_Y, KC_U, KC_I, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    [modtest]  = COMBO(modtest_combo, KC_SPACE),
+    [osmshift] = COMBO(osmshift_combo, OSM(MOD_LSFT)),
+    [overlap]  = COMBO(overlap_combo, KC_ENTER)
+};
+// clang-format on
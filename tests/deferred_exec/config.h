@@ -0,0 +1,9 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// More executors than fit 8 bit tokens
+#define MAX_DEFERRED_EXECUTORS 300
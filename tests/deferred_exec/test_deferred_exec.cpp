@@ -0,0 +1,285 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "deferred_exec.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+struct Call {
+    int      id;
+    uint32_t trigger_time;
+    uint32_t now;
+
+    bool operator==(const Call& other) const {
+        return id == other.id && trigger_time == other.trigger_time && now == other.now;
+    }
+};
+
+static std::vector<Call> calls;
+
+// Executor state passed as cb_arg, `action` returns the repeat delay
+struct Executor {
+    int                               id;
+    std::function<uint32_t(uint32_t)> action;
+};
+
+static uint32_t executor_callback(uint32_t trigger_time, void* cb_arg) {
+    Executor* executor = (Executor*)cb_arg;
+    calls.push_back({executor->id, trigger_time, timer_read32()});
+    return executor->action ? executor->action(trigger_time) : 0;
+}
+
+class DeferredExec : public TestFixture {
+   public:
+    void SetUp() override {
+        calls.clear();
+        tokens.clear();
+        // The fixture clears the timer, stay ahead of the last tick of the previous test
+        set_time(test_start_time += 100000);
+    }
+
+    void TearDown() override {
+        for (deferred_token token : tokens) {
+            cancel_deferred_exec(token);
+        }
+    }
+
+    deferred_token defer(Executor& executor, uint32_t delay_ms) {
+        deferred_token token = defer_exec(delay_ms, executor_callback, &executor);
+        tokens.push_back(token);
+        return token;
+    }
+
+    // Ticks the basic executors once per millisecond
+    void run_for(uint32_t ms) {
+        for (uint32_t i = 0; i < ms; i++) {
+            advance_time(1);
+            deferred_exec_task();
+        }
+    }
+
+    std::vector<deferred_token> tokens;
+    static inline uint32_t      test_start_time = 0;
+};
+
+TEST_F(DeferredExec, runs_in_trigger_order) {
+    Executor a{1}, b{2}, c{3};
+    uint32_t start = timer_read32();
+
+    defer(a, 30);
+    defer(b, 10);
+    defer(c, 20);
+    run_for(40);
+    EXPECT_EQ(calls, (std::vector<Call>{{2, start + 10, start + 10}, {3, start + 20, start + 20}, {1, start + 30, start + 30}}));
+}
+
+TEST_F(DeferredExec, repeats_relative_to_trigger_time) {
+    Executor a{1, [](uint32_t) { return 10; }};
+    uint32_t start = timer_read32();
+
+    defer(a, 10);
+    run_for(45);
+    ASSERT_EQ(calls.size(), 4);
+    for (size_t i = 0; i < calls.size(); i++) {
+        EXPECT_EQ(calls[i].trigger_time, start + 10 * (i + 1));
+    }
+}
+
+TEST_F(DeferredExec, late_executor_runs_once_per_tick) {
+    Executor a{1, [](uint32_t) { return 1; }};
+    uint32_t start = timer_read32();
+
+    defer(a, 1);
+    advance_time(10);
+    deferred_exec_task();
+    ASSERT_EQ(calls.size(), 1);
+
+    // catches up one trigger per tick
+    run_for(1);
+    ASSERT_EQ(calls.size(), 2);
+    EXPECT_EQ(calls[1].trigger_time, start + 2);
+}
+
+TEST_F(DeferredExec, cancelled_executor_does_not_run) {
+    Executor       a{1}, b{2};
+    deferred_token token_a = defer(a, 10);
+    defer(b, 20);
+
+    EXPECT_TRUE(cancel_deferred_exec(token_a));
+    EXPECT_FALSE(cancel_deferred_exec(token_a));
+    run_for(30);
+    ASSERT_EQ(calls.size(), 1);
+    EXPECT_EQ(calls[0].id, 2);
+}
+
+TEST_F(DeferredExec, completed_token_is_invalid) {
+    Executor       a{1};
+    deferred_token token = defer(a, 10);
+
+    run_for(10);
+    EXPECT_EQ(calls.size(), 1);
+    EXPECT_FALSE(extend_deferred_exec(token, 10));
+    EXPECT_FALSE(cancel_deferred_exec(token));
+}
+
+TEST_F(DeferredExec, extend_moves_executor_back) {
+    Executor       a{1}, b{2};
+    uint32_t       start   = timer_read32();
+    deferred_token token_a = defer(a, 10);
+    defer(b, 20);
+
+    run_for(5);
+    EXPECT_TRUE(extend_deferred_exec(token_a, 25));
+    run_for(30);
+    EXPECT_EQ(calls, (std::vector<Call>{{2, start + 20, start + 20}, {1, start + 30, start + 30}}));
+}
+
+TEST_F(DeferredExec, callback_cancels_other_due_executor) {
+    deferred_token token_b = INVALID_DEFERRED_TOKEN;
+    Executor       a{1}, b{2};
+    a.action = [&](uint32_t) {
+        EXPECT_TRUE(cancel_deferred_exec(token_b));
+        return 0;
+    };
+
+    defer(a, 10);
+    token_b = defer(b, 10);
+    run_for(20);
+    ASSERT_EQ(calls.size(), 1);
+    EXPECT_EQ(calls[0].id, 1);
+}
+
+TEST_F(DeferredExec, callback_cancels_itself_and_requeues) {
+    Executor       a{1}, b{2};
+    deferred_token token_a = INVALID_DEFERRED_TOKEN;
+    uint32_t       start   = timer_read32();
+    a.action               = [&](uint32_t) {
+        EXPECT_TRUE(cancel_deferred_exec(token_a));
+        defer(b, 5);
+        // ignored, the executor is gone
+        return 1;
+    };
+
+    token_a = defer(a, 10);
+    run_for(20);
+    EXPECT_EQ(calls, (std::vector<Call>{{1, start + 10, start + 10}, {2, start + 15, start + 15}}));
+}
+
+TEST_F(DeferredExec, callback_extends_itself) {
+    Executor       a{1};
+    deferred_token token_a = INVALID_DEFERRED_TOKEN;
+    uint32_t       start   = timer_read32();
+    a.action               = [&](uint32_t) {
+        EXPECT_TRUE(extend_deferred_exec(token_a, 10));
+        return 5;
+    };
+
+    token_a = defer(a, 10);
+    run_for(30);
+    ASSERT_EQ(calls.size(), 2);
+    EXPECT_EQ(calls[1].trigger_time, start + 25);
+}
+
+TEST_F(DeferredExec, executor_count_beyond_8_bit_tokens) {
+    std::vector<Executor>    executors(MAX_DEFERRED_EXECUTORS);
+    std::set<deferred_token> unique;
+
+    for (int i = 0; i < MAX_DEFERRED_EXECUTORS; i++) {
+        executors[i].id      = i;
+        deferred_token token = defer(executors[i], MAX_DEFERRED_EXECUTORS - i);
+        ASSERT_NE(token, INVALID_DEFERRED_TOKEN);
+        unique.insert(token);
+    }
+    EXPECT_EQ(unique.size(), MAX_DEFERRED_EXECUTORS);
+
+    Executor overflow{-1};
+    EXPECT_EQ(defer_exec(1, executor_callback, &overflow), INVALID_DEFERRED_TOKEN);
+
+    run_for(MAX_DEFERRED_EXECUTORS);
+    ASSERT_EQ(calls.size(), MAX_DEFERRED_EXECUTORS);
+    for (int i = 0; i < MAX_DEFERRED_EXECUTORS; i++) {
+        EXPECT_EQ(calls[i].id, MAX_DEFERRED_EXECUTORS - 1 - i);
+    }
+}
+
+TEST_F(DeferredExec, matches_reference_model_under_random_operations) {
+    std::mt19937          rng(0xDEFE);
+    deferred_executor_t   table[16] = {0};
+    uint32_t              last_exec = 0;
+    std::vector<Executor> executors(16);
+
+    // id -> trigger time of the pending executors
+    std::map<int, uint32_t>       pending;
+    std::map<int, deferred_token> token_of;
+    int                           next_id = 0;
+
+    for (int step = 0; step < 5000; step++) {
+        switch (rng() % 4) {
+            case 0: {
+                size_t   slot  = std::find_if(executors.begin(), executors.end(), [&](Executor& e) { return pending.count(e.id) == 0; }) - executors.begin();
+                uint32_t delay = 1 + rng() % 20;
+                if (slot == executors.size()) {
+                    EXPECT_EQ(defer_exec_advanced(table, 16, delay, executor_callback, &executors[0]), INVALID_DEFERRED_TOKEN);
+                    break;
+                }
+                executors[slot].id   = next_id++;
+                deferred_token token = defer_exec_advanced(table, 16, delay, executor_callback, &executors[slot]);
+                ASSERT_NE(token, INVALID_DEFERRED_TOKEN);
+                pending[executors[slot].id]  = timer_read32() + delay;
+                token_of[executors[slot].id] = token;
+                break;
+            }
+            case 1:
+                if (!pending.empty()) {
+                    auto it = std::next(pending.begin(), rng() % pending.size());
+                    EXPECT_TRUE(cancel_deferred_exec_advanced(table, 16, token_of[it->first]));
+                    pending.erase(it);
+                }
+                break;
+            case 2:
+                if (!pending.empty()) {
+                    auto     it    = std::next(pending.begin(), rng() % pending.size());
+                    uint32_t delay = 1 + rng() % 20;
+                    EXPECT_TRUE(extend_deferred_exec_advanced(table, 16, token_of[it->first], delay));
+                    it->second = timer_read32() + delay;
+                }
+                break;
+            default: {
+                advance_time(1);
+                calls.clear();
+                deferred_exec_advanced_task(table, 16, &last_exec);
+
+                // every due executor ran once, earliest trigger first
+                std::vector<std::pair<uint32_t, int>> due;
+                for (auto& entry : pending) {
+                    if (entry.second <= timer_read32()) {
+                        due.push_back({entry.second, entry.first});
+                    }
+                }
+                std::sort(due.begin(), due.end());
+                ASSERT_EQ(calls.size(), due.size()) << "step " << step;
+                for (size_t i = 0; i < due.size(); i++) {
+                    EXPECT_EQ(calls[i].trigger_time, due[i].first) << "step " << step;
+                    if (i > 0 && due[i].first != due[i - 1].first) {
+                        EXPECT_EQ(calls[i].id, due[i].second) << "step " << step;
+                    }
+                    pending.erase(due[i].second);
+                }
+                break;
+            }
+        }
+    }
+}
@@ -0,0 +1,13 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define DYNAMIC_KEYMAP_CACHE_ENABLE
+#define DYNAMIC_KEYMAP_CACHE_PAGE_SIZE 16
+#define DYNAMIC_KEYMAP_CACHE_FLUSH_DELAY 500
+
+// The default test EEPROM only holds eeconfig
+#define EEPROM_SIZE 1024
@@ -0,0 +1,106 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "dynamic_keymap.h"
+#include "keycodes.h"
+#include "keymap_introspection.h"
+#include "nvm_dynamic_keymap.h"
+#include "timer.h"
+
+void advance_time(uint32_t ms);
+}
+
+class DynamicKeymapCache : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        // The cache outlives each test, start from a flushed, known keymap
+        for (uint8_t layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
+            for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+                for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                    dynamic_keymap_set_keycode(layer, row, col, KC_NO);
+                }
+            }
+        }
+        dynamic_keymap_flush();
+    }
+
+    // Runs the task as the main loop would for `ms` milliseconds
+    void run_task(uint32_t ms) {
+        for (uint32_t i = 0; i < ms; i++) {
+            advance_time(1);
+            dynamic_keymap_task();
+        }
+    }
+};
+
+TEST_F(DynamicKeymapCache, reads_are_served_before_write_back) {
+    dynamic_keymap_set_keycode(1, 2, 3, KC_B);
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 2, 3), KC_B);
+    EXPECT_EQ(nvm_dynamic_keymap_read_keycode(1, 2, 3), KC_NO);
+}
+
+TEST_F(DynamicKeymapCache, writes_back_after_the_host_goes_quiet) {
+    dynamic_keymap_set_keycode(0, 0, 1, KC_A);
+    run_task(DYNAMIC_KEYMAP_CACHE_FLUSH_DELAY - 10);
+    dynamic_keymap_set_keycode(0, 0, 2, KC_C);
+
+    // The second edit restarts the delay
+    run_task(DYNAMIC_KEYMAP_CACHE_FLUSH_DELAY - 10);
+    EXPECT_EQ(nvm_dynamic_keymap_read_keycode(0, 0, 1), KC_NO);
+
+    run_task(20);
+    EXPECT_EQ(nvm_dynamic_keymap_read_keycode(0, 0, 1), KC_A);
+    EXPECT_EQ(nvm_dynamic_keymap_read_keycode(0, 0, 2), KC_C);
+}
+
+TEST_F(DynamicKeymapCache, writes_back_one_page_per_task_call) {
+    // Keycodes at the start of the first and last pages of layer 0
+    const uint8_t last_row = MATRIX_ROWS - 1, last_col = MATRIX_COLS - 1;
+    dynamic_keymap_set_keycode(0, 0, 0, KC_X);
+    dynamic_keymap_set_keycode(0, last_row, last_col, KC_Y);
+    advance_time(DYNAMIC_KEYMAP_CACHE_FLUSH_DELAY);
+
+    dynamic_keymap_task();
+    EXPECT_EQ(nvm_dynamic_keymap_read_keycode(0, 0, 0), KC_X);
+    EXPECT_EQ(nvm_dynamic_keymap_read_keycode(0, last_row, last_col), KC_NO);
+
+    dynamic_keymap_task();
+    EXPECT_EQ(nvm_dynamic_keymap_read_keycode(0, last_row, last_col), KC_Y);
+}
+
+TEST_F(DynamicKeymapCache, buffer_matches_the_nvm_layout) {
+    uint8_t data[4] = {0x00, KC_E, 0x00, KC_F};
+    dynamic_keymap_set_buffer((1 * MATRIX_ROWS * MATRIX_COLS + 1) * 2, sizeof(data), data);
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 0, 1), KC_E);
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 0, 2), KC_F);
+
+    uint8_t read[4] = {0};
+    dynamic_keymap_get_buffer((1 * MATRIX_ROWS * MATRIX_COLS + 1) * 2, sizeof(read), read);
+    EXPECT_EQ(memcmp(data, read, sizeof(data)), 0);
+
+    dynamic_keymap_flush();
+    uint8_t nvm[4] = {0};
+    nvm_dynamic_keymap_read_buffer((1 * MATRIX_ROWS * MATRIX_COLS + 1) * 2, sizeof(nvm), nvm);
+    EXPECT_EQ(memcmp(data, nvm, sizeof(data)), 0);
+
+    // Past the end reads back as zero and is not written
+    const uint16_t end = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
+    dynamic_keymap_set_buffer(end - 2, sizeof(data), data);
+    dynamic_keymap_get_buffer(end - 2, sizeof(read), read);
+    EXPECT_EQ(read[1], KC_E);
+    EXPECT_EQ(read[2], 0);
+    EXPECT_EQ(read[3], 0);
+}
+
+TEST_F(DynamicKeymapCache, reset_rewrites_the_whole_keymap) {
+    dynamic_keymap_set_keycode(2, 1, 1, KC_G);
+    dynamic_keymap_flush();
+
+    dynamic_keymap_reset();
+    dynamic_keymap_flush();
+    EXPECT_EQ(dynamic_keymap_get_keycode(2, 1, 1), keycode_at_keymap_location_raw(2, 1, 1));
+    EXPECT_EQ(nvm_dynamic_keymap_read_keycode(2, 1, 1), keycode_at_keymap_location_raw(2, 1, 1));
+}
@@ -0,0 +1,113 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+
+extern "C" {
+#include "dynamic_keymap.h"
+}
+
+using ::testing::_;
+using ::testing::InSequence;
+
+class DynamicKeymapMacro : public TestFixture {
+   public:
+    void SetUp() override {
+        dynamic_keymap_macro_reset();
+    }
+
+    // Writes `macros` as VIA does, flagging the buffer as busy until the final write
+    void WriteMacros(const std::string& macros) {
+        const uint16_t size = dynamic_keymap_macro_get_buffer_size();
+        uint8_t        busy = 0xFF, done = 0x00;
+        dynamic_keymap_macro_set_buffer(size - 1, 1, &busy);
+        dynamic_keymap_macro_set_buffer(0, macros.size(), (uint8_t*)macros.data());
+        dynamic_keymap_macro_set_buffer(size - 1, 1, &done);
+    }
+
+    // Expects that the lowercase letters of `s` are tapped
+    void ExpectString(TestDriver& driver, const std::string& s) {
+        InSequence seq;
+        for (char c : s) {
+            EXPECT_REPORT(driver, (KC_A + (c - 'a')));
+            EXPECT_EMPTY_REPORT(driver);
+        }
+    }
+};
+
+TEST_F(DynamicKeymapMacro, sends_the_nth_macro) {
+    TestDriver driver;
+    WriteMacros(std::string("ab\0cdefghij\0\0k", 15));
+
+    ExpectString(driver, "cdefghij");
+    dynamic_keymap_macro_send(1);
+    VERIFY_AND_CLEAR(driver);
+
+    ExpectString(driver, "k");
+    dynamic_keymap_macro_send(3);
+    VERIFY_AND_CLEAR(driver);
+
+    // Empty macro
+    EXPECT_NO_REPORT(driver);
+    dynamic_keymap_macro_send(2);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicKeymapMacro, missing_macros_send_nothing) {
+    TestDriver driver;
+    WriteMacros(std::string("ab\0", 3));
+
+    EXPECT_NO_REPORT(driver);
+    dynamic_keymap_macro_send(2);
+    dynamic_keymap_macro_send(3);
+    dynamic_keymap_macro_send(DYNAMIC_KEYMAP_MACRO_COUNT);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicKeymapMacro, rewritten_buffer_is_reindexed) {
+    TestDriver driver;
+    WriteMacros(std::string("ab\0cd\0", 6));
+    ExpectString(driver, "cd");
+    dynamic_keymap_macro_send(1);
+    VERIFY_AND_CLEAR(driver);
+
+    WriteMacros(std::string("efgh\0ij\0", 8));
+    ExpectString(driver, "ij");
+    dynamic_keymap_macro_send(1);
+    VERIFY_AND_CLEAR(driver);
+
+    dynamic_keymap_macro_reset();
+    EXPECT_NO_REPORT(driver);
+    dynamic_keymap_macro_send(0);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicKeymapMacro, interrupted_write_disables_sending) {
+    TestDriver driver;
+    const uint16_t size = dynamic_keymap_macro_get_buffer_size();
+    uint8_t        busy = 0xFF;
+    WriteMacros(std::string("ab\0", 3));
+    dynamic_keymap_macro_set_buffer(size - 1, 1, &busy);
+    dynamic_keymap_macro_set_buffer(0, 3, (uint8_t*)"cd");
+
+    EXPECT_NO_REPORT(driver);
+    dynamic_keymap_macro_send(0);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicKeymapMacro, macro_at_the_end_of_the_buffer_stops_at_the_end) {
+    TestDriver driver;
+    const uint16_t size = dynamic_keymap_macro_get_buffer_size();
+    std::string    macros(size - 3, 'z');
+    macros[0] = '\0';
+    WriteMacros(macros + "xy");
+
+    ExpectString(driver, std::string(size - 4, 'z') + "xy");
+    dynamic_keymap_macro_send(1);
+    VERIFY_AND_CLEAR(driver);
+}
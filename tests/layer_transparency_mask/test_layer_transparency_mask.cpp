@@ -0,0 +1,137 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <random>
+
+#include "keycodes.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class LayerTransparencyMask : public TestFixture {
+   public:
+    void TearDown() override {
+        layer_clear();
+        default_layer_set(1);
+    }
+
+    /**
+     * @brief Maps every position left unmapped to KC_TRNS on all layers, and
+     * drops the masks built from the previous keymap.
+     */
+    void fill_transparent() {
+        for (uint8_t layer = 0; layer < MAX_LAYER; layer++) {
+            for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+                for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                    if (!find_key(layer, keypos_t{.col = col, .row = row})) {
+                        add_key(KeymapKey(layer, col, row, KC_TRNS));
+                    }
+                }
+            }
+        }
+        layer_transparency_mask_invalidate();
+    }
+
+    /**
+     * @brief The top down scan layer_switch_get_layer() does without the mask.
+     */
+    static uint8_t linear_get_layer(keypos_t key) {
+        layer_state_t layers = layer_state | default_layer_state;
+        for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
+            if ((layers & ((layer_state_t)1 << i)) && action_for_key(i, key).code != ACTION_TRANSPARENT) {
+                return i;
+            }
+        }
+        return 0;
+    }
+};
+
+TEST_F(LayerTransparencyMask, MatchesLinearScanForRandomizedKeymaps) {
+    std::mt19937                            rng(0x1A7E);
+    std::uniform_int_distribution<uint16_t> keycode(KC_A, KC_Z);
+    std::bernoulli_distribution             transparent(0.8);
+    std::uniform_int_distribution<uint32_t> state;
+
+    for (int iteration = 0; iteration < 20; ++iteration) {
+        keymap.clear();
+        for (uint8_t layer = 0; layer < MAX_LAYER; layer++) {
+            for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+                for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                    add_key(KeymapKey(layer, col, row, transparent(rng) ? KC_TRNS : keycode(rng)));
+                }
+            }
+        }
+        layer_transparency_mask_invalidate();
+
+        for (int states = 0; states < 20; ++states) {
+            layer_state         = state(rng);
+            default_layer_state = (layer_state_t)1 << (state(rng) % MAX_LAYER);
+            for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+                for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                    const keypos_t key = keypos_t{.col = col, .row = row};
+                    EXPECT_EQ(layer_switch_get_layer(key), linear_get_layer(key)) << "iteration " << iteration << ", (" << +col << "," << +row << ")";
+                }
+            }
+        }
+    }
+}
+
+TEST_F(LayerTransparencyMask, FallsBackToLayerZero) {
+    fill_transparent();
+
+    layer_state = 0xFFFFFFFF;
+    EXPECT_EQ(layer_switch_get_layer(keypos_t{.col = 0, .row = 0}), 0);
+}
+
+TEST_F(LayerTransparencyMask, TransparentKeyResolvesToLowerLayer) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_mo    = KeymapKey(0, 0, 0, MO(31));
+    KeymapKey  key_a     = KeymapKey(0, 1, 0, KC_A);
+    KeymapKey  key_b     = KeymapKey(0, 2, 0, KC_B);
+    KeymapKey  key_upper = KeymapKey(31, 2, 0, KC_C);
+
+    set_keymap({key_mo, key_a, key_b, key_upper});
+    fill_transparent();
+
+    layer_on(16);
+    EXPECT_NO_REPORT(driver);
+    key_mo.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_b);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    key_mo.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_b);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerTransparencyMask, InvalidatePicksUpKeymapChanges) {
+    TestDriver driver;
+    KeymapKey  key_a = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key_a});
+    fill_transparent();
+    layer_on(1);
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+
+    set_keymap({key_a, KeymapKey(1, 0, 0, KC_B)});
+    fill_transparent();
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 1);
+}
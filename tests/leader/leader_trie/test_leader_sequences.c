@@ -0,0 +1,30 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+// As generated by qmk json2c from:
+//     "leader_sequences": [
+//         {"sequence": ["KC_A"], "keycode": "KC_1"},
+//         {"sequence": ["KC_A", "KC_B"], "keycode": "KC_2"},
+//         {"sequence": ["KC_C", "KC_D"], "keycode": "LCTL(KC_3)"}
+//     ]
+#define LEADER_TRIE_DEFINED
+const leader_trie_node_t PROGMEM leader_trie[] = {
+    [0] = {KC_NO, KC_NO, 1, 2},
+    [1] = {KC_A, KC_1, 3, 1},
+    [2] = {KC_C, KC_NO, 4, 1},
+    [3] = {KC_B, KC_2, 0, 0},
+    [4] = {KC_D, LCTL(KC_3), 0, 0},
+};
+
+// Sequences in code alongside the declared ones
+void leader_end_user(void) {
+    if (leader_sequence_three_keys(KC_A, KC_B, KC_C)) {
+        tap_code(KC_8);
+    }
+
+    if (leader_sequence_two_keys(KC_C, KC_E)) {
+        tap_code(KC_9);
+    }
+}
@@ -0,0 +1,105 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class LeaderTrie : public TestFixture {};
+
+TEST_F(LeaderTrie, declared_sequence_triggers_on_timeout) {
+    TestDriver driver;
+    InSequence s;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_c      = KeymapKey(0, 1, 0, KC_C);
+    auto key_d      = KeymapKey(0, 2, 0, KC_D);
+
+    set_keymap({key_leader, key_c, key_d});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_c);
+    tap_key(key_d);
+
+    EXPECT_EQ(leader_sequence_active(), true);
+
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL, KC_3));
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(300);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+}
+
+TEST_F(LeaderTrie, code_sequence_extending_a_declared_one) {
+    TestDriver driver;
+    InSequence s;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_a      = KeymapKey(0, 1, 0, KC_A);
+    auto key_b      = KeymapKey(0, 2, 0, KC_B);
+    auto key_c      = KeymapKey(0, 3, 0, KC_C);
+
+    set_keymap({key_leader, key_a, key_b, key_c});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_a);
+    tap_key(key_b);
+    tap_key(key_c);
+
+    EXPECT_EQ(leader_sequence_active(), true);
+
+    EXPECT_REPORT(driver, (KC_8));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(300);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+}
+
+TEST_F(LeaderTrie, code_sequence_leaving_a_declared_prefix) {
+    TestDriver driver;
+    InSequence s;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_c      = KeymapKey(0, 1, 0, KC_C);
+    auto key_e      = KeymapKey(0, 2, 0, KC_E);
+
+    set_keymap({key_leader, key_c, key_e});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_c);
+    tap_key(key_e);
+
+    EXPECT_EQ(leader_sequence_active(), true);
+
+    EXPECT_REPORT(driver, (KC_9));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(300);
+}
+
+TEST_F(LeaderTrie, declared_prefix_extended_by_unknown_key_triggers_nothing) {
+    TestDriver driver;
+    InSequence s;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_a      = KeymapKey(0, 1, 0, KC_A);
+    auto key_c      = KeymapKey(0, 2, 0, KC_C);
+
+    set_keymap({key_leader, key_a, key_c});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_a);
+    tap_key(key_c);
+    idle_for(300);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+}
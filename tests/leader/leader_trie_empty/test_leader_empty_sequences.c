@@ -0,0 +1,17 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+// As generated by qmk json2c from:
+//     "leader_sequences": []
+#define LEADER_TRIE_DEFINED
+const leader_trie_node_t PROGMEM leader_trie[] = {
+    [0] = {KC_NO, KC_NO, 0, 0},
+};
+
+void leader_end_user(void) {
+    if (leader_sequence_two_keys(KC_A, KC_B)) {
+        tap_code(KC_2);
+    }
+}
@@ -0,0 +1,68 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class MatrixChangedRows : public TestFixture {};
+
+TEST_F(MatrixChangedRows, NoReportWithoutChanges) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+    keyboard_task();
+    keyboard_task();
+}
+
+TEST_F(MatrixChangedRows, KeysOnLastRowAndColumnAreReported) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, MATRIX_COLS - 1, MATRIX_ROWS - 1, KC_A);
+
+    set_keymap({key});
+
+    key.press();
+    EXPECT_REPORT(driver, (key.report_code));
+    keyboard_task();
+
+    key.release();
+    EXPECT_EMPTY_REPORT(driver);
+    keyboard_task();
+}
+
+TEST_F(MatrixChangedRows, ChangesInOneScanAreProcessedInMatrixOrder) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 7, 2, KC_A);
+    auto       key_b = KeymapKey(0, 1, 0, KC_B);
+    auto       key_c = KeymapKey(0, 3, 0, KC_C);
+    auto       key_d = KeymapKey(0, 0, 3, KC_D);
+
+    set_keymap({key_a, key_b, key_c, key_d});
+
+    key_a.press();
+    key_b.press();
+    key_c.press();
+    key_d.press();
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_REPORT(driver, (KC_B, KC_C));
+    EXPECT_REPORT(driver, (KC_B, KC_C, KC_A));
+    EXPECT_REPORT(driver, (KC_B, KC_C, KC_A, KC_D));
+    keyboard_task();
+    VERIFY_AND_CLEAR(driver);
+
+    key_b.release();
+    key_d.release();
+    EXPECT_REPORT(driver, (KC_C, KC_A, KC_D));
+    EXPECT_REPORT(driver, (KC_C, KC_A));
+    keyboard_task();
+    VERIFY_AND_CLEAR(driver);
+
+    key_a.release();
+    key_c.release();
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    keyboard_task();
+    VERIFY_AND_CLEAR(driver);
+}
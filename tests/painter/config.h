@@ -0,0 +1,10 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define SURFACE_NUM_DEVICES 2
+#define QUANTUM_PAINTER_SUPPORTS_256_PALETTE true
+#define QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER true
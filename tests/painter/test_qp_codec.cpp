@@ -0,0 +1,185 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <random>
+#include <vector>
+#include "test_common.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_internal.h"
+#include "qp_draw.h"
+#include "qp_surface_internal.h"
+}
+
+#define PANEL_WIDTH 100
+#define PANEL_HEIGHT 40
+
+static uint8_t surface_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH, PANEL_HEIGHT, 16)];
+
+// Wraps a memory stream so that it is no longer recognised as one, forcing the byte-at-a-time decode path
+typedef struct wrapped_stream_t {
+    qp_stream_t         base;
+    qp_memory_stream_t *inner;
+} wrapped_stream_t;
+
+static int16_t wrapped_get(qp_stream_t *stream) {
+    return qp_stream_get(((wrapped_stream_t *)stream)->inner);
+}
+
+static wrapped_stream_t make_wrapped_stream(qp_memory_stream_t *inner) {
+    wrapped_stream_t stream = {};
+    stream.base.get         = wrapped_get;
+    stream.inner            = inner;
+    return stream;
+}
+
+// Mirrors the encoder in lib/python/qmk/painter.py closely enough to produce both run types
+static std::vector<uint8_t> rle_encode(const std::vector<uint8_t> &input) {
+    std::vector<uint8_t> output;
+    size_t               i = 0;
+    while (i < input.size()) {
+        size_t run = 1;
+        while (i + run < input.size() && input[i + run] == input[i] && run < 127) {
+            ++run;
+        }
+        if (run >= 3) {
+            output.push_back(run);
+            output.push_back(input[i]);
+            i += run;
+            continue;
+        }
+        size_t literal = 0;
+        while (i + literal < input.size() && literal < 128) {
+            if (i + literal + 2 < input.size() && input[i + literal] == input[i + literal + 1] && input[i + literal] == input[i + literal + 2]) {
+                break;
+            }
+            ++literal;
+        }
+        output.push_back(127 + literal);
+        output.insert(output.end(), input.begin() + i, input.begin() + i + literal);
+        i += literal;
+    }
+    return output;
+}
+
+// Random pixel data with plenty of repeated runs
+static std::vector<uint8_t> make_pixels(uint32_t seed, size_t length) {
+    std::mt19937                       rng(seed);
+    std::uniform_int_distribution<int> value(0, 255);
+    std::uniform_int_distribution<int> run(1, 40);
+    std::vector<uint8_t>               data;
+    while (data.size() < length) {
+        uint8_t b = value(rng);
+        data.insert(data.end(), (value(rng) & 1) ? run(rng) : 1, b);
+    }
+    data.resize(length);
+    return data;
+}
+
+class QpCodec : public ::testing::Test {
+   protected:
+    painter_device_t surface;
+
+    void SetUp() override {
+        memset(surface_drivers, 0, sizeof(surface_drivers));
+        surface = qp_make_rgb565_surface(PANEL_WIDTH, PANEL_HEIGHT, surface_buffer);
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+
+        // Distinct colors for every palette entry
+        qp_internal_invalidate_palette();
+        for (int i = 0; i < 256; ++i) {
+            qp_internal_global_pixel_lookup_table[i].rgb565 = 0x1000 + i * 7;
+        }
+    }
+
+    // Renders the encoded pixels into the given area, in the given number of parts to mimic glyph-by-glyph rendering
+    // of fonts, returning the resulting surface contents and input state
+    std::vector<uint8_t> render(std::vector<uint8_t> &encoded, painter_compression_t compression, uint8_t bpp, uint16_t width, uint16_t height, bool wrapped, int parts, qp_internal_byte_input_state_t *final_state, int32_t *final_position) {
+        memset(surface_buffer, 0, sizeof(surface_buffer));
+
+        qp_memory_stream_t mem_stream = qp_make_memory_stream(encoded.data(), encoded.size());
+        wrapped_stream_t   wrap       = make_wrapped_stream(&mem_stream);
+
+        qp_internal_byte_input_state_t  input_state    = {.device = surface, .src_stream = wrapped ? &wrap.base : &mem_stream.base};
+        qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, compression);
+
+        painter_driver_t *driver = (painter_driver_t *)surface;
+        uint16_t          rows   = height / parts;
+        for (int p = 0; p < parts; ++p) {
+            uint16_t t = p * rows;
+            uint16_t b = (p == parts - 1) ? height - 1 : t + rows - 1;
+            EXPECT_TRUE(driver->driver_vtable->viewport(surface, 0, t, width - 1, b));
+            EXPECT_TRUE(qp_internal_appender(surface, bpp, (uint32_t)width * (b - t + 1), input_callback, &input_state));
+        }
+
+        *final_state    = input_state;
+        *final_position = mem_stream.position;
+        return std::vector<uint8_t>(surface_buffer, surface_buffer + sizeof(surface_buffer));
+    }
+
+    void check(uint32_t seed, painter_compression_t compression, uint8_t bpp, uint16_t width, uint16_t height, int parts) {
+        const uint32_t       pixels_per_row = (width * bpp + 7) / 8 * 8 / bpp;
+        std::vector<uint8_t> raw            = make_pixels(seed, (pixels_per_row * height * bpp + 7) / 8);
+        std::vector<uint8_t> encoded        = compression == IMAGE_COMPRESSED_RLE ? rle_encode(raw) : raw;
+
+        qp_internal_byte_input_state_t byte_state, bulk_state;
+        int32_t                        byte_position, bulk_position;
+        auto                           expected = render(encoded, compression, bpp, width, height, true, parts, &byte_state, &byte_position);
+        auto                           actual   = render(encoded, compression, bpp, width, height, false, parts, &bulk_state, &bulk_position);
+
+        EXPECT_EQ(actual, expected) << "Surface mismatch, bpp " << (int)bpp << ", compression " << (int)compression << ", " << width << "x" << height << ", parts " << parts;
+        EXPECT_EQ(bulk_position, byte_position) << "Stream position mismatch";
+        EXPECT_EQ(bulk_state.curr, byte_state.curr) << "Queued byte mismatch, bpp " << (int)bpp << ", compression " << (int)compression << ", parts " << parts;
+        if (compression == IMAGE_COMPRESSED_RLE) {
+            EXPECT_EQ(bulk_state.rle.mode, byte_state.rle.mode) << "RLE mode mismatch";
+            EXPECT_EQ(bulk_state.rle.remain, byte_state.rle.remain) << "RLE remaining count mismatch";
+        }
+    }
+};
+
+/**
+ * The bulk path produces the same pixels as the byte-at-a-time path for every palette depth, for both compression
+ * schemes, including pixel counts which end part-way through a byte and which span several pixdata buffers.
+ */
+TEST_F(QpCodec, BulkMatchesByteDecoder) {
+    for (uint8_t bpp : {1, 2, 4, 8}) {
+        for (painter_compression_t compression : {IMAGE_UNCOMPRESSED, IMAGE_COMPRESSED_RLE}) {
+            check(bpp, compression, bpp, PANEL_WIDTH, PANEL_HEIGHT, 1);
+            check(bpp + 100, compression, bpp, 37, 13, 1);
+        }
+    }
+}
+
+/**
+ * Fonts reuse the same input state for every glyph, so the bulk path must leave it exactly where the byte-at-a-time
+ * path would have.
+ */
+TEST_F(QpCodec, BulkPreservesInputStateAcrossCalls) {
+    for (uint8_t bpp : {1, 2, 4, 8}) {
+        for (painter_compression_t compression : {IMAGE_UNCOMPRESSED, IMAGE_COMPRESSED_RLE}) {
+            check(bpp + 200, compression, bpp, 16, 40, 5);
+            check(bpp + 300, compression, bpp, 8, 39, 13);
+        }
+    }
+}
+
+/**
+ * Truncated input fails rather than reading past the end of the buffer.
+ */
+TEST_F(QpCodec, BulkRejectsTruncatedInput) {
+    std::vector<uint8_t> raw     = make_pixels(42, PANEL_WIDTH * PANEL_HEIGHT / 2);
+    std::vector<uint8_t> encoded = rle_encode(raw);
+
+    for (painter_compression_t compression : {IMAGE_UNCOMPRESSED, IMAGE_COMPRESSED_RLE}) {
+        std::vector<uint8_t>            truncated(compression == IMAGE_COMPRESSED_RLE ? encoded.begin() : raw.begin(), (compression == IMAGE_COMPRESSED_RLE ? encoded.end() : raw.end()) - 3);
+        qp_memory_stream_t              mem_stream     = qp_make_memory_stream(truncated.data(), truncated.size());
+        qp_internal_byte_input_state_t  input_state    = {.device = surface, .src_stream = &mem_stream.base};
+        qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, compression);
+
+        painter_driver_t *driver = (painter_driver_t *)surface;
+        EXPECT_TRUE(driver->driver_vtable->viewport(surface, 0, 0, PANEL_WIDTH - 1, PANEL_HEIGHT - 1));
+        EXPECT_FALSE(qp_internal_appender(surface, 4, PANEL_WIDTH * PANEL_HEIGHT, input_callback, &input_state));
+        EXPECT_LE(mem_stream.position, mem_stream.length);
+    }
+}
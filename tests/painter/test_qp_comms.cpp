@@ -0,0 +1,207 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "test_common.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_internal.h"
+#include "qp_comms.h"
+#include "qp_comms_dummy.h"
+#include "qp_draw.h"
+#include "qp_surface_internal.h"
+
+extern const surface_painter_driver_vtable_t rgb565_surface_driver_vtable;
+}
+
+#define PANEL_WIDTH 100
+#define PANEL_HEIGHT 40
+
+static uint8_t source_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH, PANEL_HEIGHT, 16)];
+static uint8_t target_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH, PANEL_HEIGHT, 16)];
+
+// Each chunk of pixel data as seen by the comms layer, in transmission order
+struct chunk_t {
+    const void          *buffer;
+    std::vector<uint8_t> data;
+    bool                 async;
+};
+
+static std::vector<chunk_t> chunks;
+static std::thread          transfer;
+static int                  transfers_in_flight;
+static bool                 buffer_modified_in_flight;
+static bool                 async_supported;
+
+static void finish_transfer() {
+    if (transfer.joinable()) {
+        transfer.join();
+    }
+}
+
+static uint32_t test_comms_send(painter_device_t device, const void *data, uint32_t byte_count) {
+    const uint8_t *p = (const uint8_t *)data;
+    chunks.push_back({data, std::vector<uint8_t>(p, p + byte_count), false});
+    return byte_count;
+}
+
+// Emulates a DMA transfer, which completes in the background a little while later
+static bool test_comms_send_async(painter_device_t device, const void *data, uint32_t byte_count, painter_driver_comms_complete_func complete) {
+    if (!async_supported) {
+        return false;
+    }
+
+    finish_transfer();
+    EXPECT_EQ(transfers_in_flight, 0) << "Only one transfer may be in flight";
+
+    const uint8_t *p = (const uint8_t *)data;
+    chunks.push_back({data, std::vector<uint8_t>(p, p + byte_count), true});
+    transfers_in_flight++;
+
+    const std::vector<uint8_t> *snapshot = &chunks.back().data;
+    transfer                             = std::thread([=]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        if (memcmp(p, snapshot->data(), byte_count) != 0) {
+            buffer_modified_in_flight = true;
+        }
+        transfers_in_flight--;
+        complete(device);
+    });
+    return true;
+}
+
+static bool test_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    return qp_comms_send(device, pixel_data, native_pixel_count * 2) == native_pixel_count * 2;
+}
+
+static painter_comms_vtable_t  test_comms_vtable;
+static painter_driver_vtable_t test_driver_vtable;
+
+class QpComms : public ::testing::Test {
+   protected:
+    painter_device_t source;
+    painter_device_t target;
+
+    void SetUp() override {
+        chunks.clear();
+        chunks.reserve(64);
+        transfers_in_flight       = 0;
+        buffer_modified_in_flight = false;
+        async_supported           = true;
+
+        memset(surface_drivers, 0, sizeof(surface_drivers));
+        source = qp_make_rgb565_surface(PANEL_WIDTH, PANEL_HEIGHT, source_buffer);
+        target = qp_make_rgb565_surface(PANEL_WIDTH, PANEL_HEIGHT, target_buffer);
+
+        // The target streams its pixel data through the test comms, based on the dummy comms
+        test_comms_vtable                  = dummy_comms_vtable;
+        test_comms_vtable.comms_send       = test_comms_send;
+        test_comms_vtable.comms_send_async = test_comms_send_async;
+        test_driver_vtable                 = rgb565_surface_driver_vtable.base;
+        test_driver_vtable.pixdata         = test_pixdata;
+
+        ((painter_driver_t *)target)->comms_vtable  = &test_comms_vtable;
+        ((painter_driver_t *)target)->driver_vtable = &test_driver_vtable;
+
+        ASSERT_TRUE(qp_init(source, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(target, QP_ROTATION_0));
+
+        // Every pixel of the source is distinct
+        uint16_t *pixels = (uint16_t *)source_buffer;
+        for (int i = 0; i < PANEL_WIDTH * PANEL_HEIGHT; ++i) {
+            pixels[i] = 0x1000 + i;
+        }
+    }
+
+    void TearDown() override {
+        finish_transfer();
+    }
+
+    std::vector<uint8_t> received() {
+        std::vector<uint8_t> all;
+        for (const auto &chunk : chunks) {
+            all.insert(all.end(), chunk.data.begin(), chunk.data.end());
+        }
+        return all;
+    }
+
+    void expect_double_buffered() {
+        EXPECT_FALSE(buffer_modified_in_flight) << "A pixdata buffer was modified while being transmitted";
+        EXPECT_EQ(transfers_in_flight, 0) << "Transfer still in flight after comms were stopped";
+        for (size_t i = 0; i < chunks.size(); ++i) {
+            EXPECT_TRUE(chunks[i].async) << "Chunk " << i << " was not sent asynchronously";
+            if (i > 0) {
+                EXPECT_NE(chunks[i].buffer, chunks[i - 1].buffer) << "Chunk " << i << " did not alternate pixdata buffers";
+            }
+        }
+    }
+};
+
+/**
+ * Surface transfers are split into chunks, which arrive in order while alternating between the two pixdata buffers.
+ */
+TEST_F(QpComms, SurfaceTransferIsDoubleBuffered) {
+    ASSERT_TRUE(qp_surface_draw(source, target, 0, 0, true));
+
+    const uint32_t pixels_per_chunk = qp_internal_num_pixels_in_buffer(target);
+    EXPECT_EQ(chunks.size(), (PANEL_WIDTH * PANEL_HEIGHT + pixels_per_chunk - 1) / pixels_per_chunk);
+    EXPECT_EQ(received(), std::vector<uint8_t>(source_buffer, source_buffer + sizeof(source_buffer)));
+    expect_double_buffered();
+}
+
+/**
+ * Decoded image data is prepared in one pixdata buffer while the other is being transmitted.
+ */
+TEST_F(QpComms, ImageDecodeIsDoubleBuffered) {
+    std::vector<uint8_t> indices(PANEL_WIDTH * PANEL_HEIGHT / 2);
+    for (size_t i = 0; i < indices.size(); ++i) {
+        indices[i] = (uint8_t)(i * 37);
+    }
+    for (int i = 0; i < 16; ++i) {
+        qp_internal_global_pixel_lookup_table[i].rgb565 = 0x2000 + i;
+    }
+
+    qp_memory_stream_t              stream         = qp_make_memory_stream(indices.data(), indices.size());
+    qp_internal_byte_input_state_t  input_state    = {.device = target, .src_stream = &stream.base};
+    qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, IMAGE_UNCOMPRESSED);
+
+    ASSERT_TRUE(qp_comms_start(target));
+    ASSERT_TRUE(qp_internal_appender(target, 4, PANEL_WIDTH * PANEL_HEIGHT, input_callback, &input_state));
+    qp_comms_stop(target);
+
+    std::vector<uint8_t> expected;
+    for (uint8_t b : indices) {
+        for (uint8_t index : {b & 0x0F, b >> 4}) {
+            uint16_t pixel = qp_internal_global_pixel_lookup_table[index].rgb565;
+            expected.push_back(pixel & 0xFF);
+            expected.push_back(pixel >> 8);
+        }
+    }
+    EXPECT_EQ(received(), expected);
+    expect_double_buffered();
+}
+
+/**
+ * Comms drivers unable to start an asynchronous transfer fall back to synchronous transmission.
+ */
+TEST_F(QpComms, SynchronousFallback) {
+    async_supported = false;
+    ASSERT_TRUE(qp_surface_draw(source, target, 0, 0, true));
+
+    EXPECT_EQ(received(), std::vector<uint8_t>(source_buffer, source_buffer + sizeof(source_buffer)));
+    for (const auto &chunk : chunks) {
+        EXPECT_FALSE(chunk.async);
+    }
+}
+
+/**
+ * The dummy comms driver completes asynchronous transfers immediately.
+ */
+TEST_F(QpComms, DummyCommsCompletesImmediately) {
+    test_comms_vtable.comms_send_async = dummy_comms_vtable.comms_send_async;
+    ASSERT_TRUE(qp_surface_draw(source, target, 0, 0, true));
+    EXPECT_TRUE(chunks.empty());
+}
@@ -0,0 +1,172 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <utility>
+#include <vector>
+#include "test_common.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_internal.h"
+#include "qp_surface_internal.h"
+#include "qff.h"
+}
+
+#define PANEL_WIDTH 240
+#define PANEL_HEIGHT 16
+#define LINE_HEIGHT 8
+
+static uint8_t surface_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH, PANEL_HEIGHT, 16)];
+
+static void put_le(std::vector<uint8_t> &out, uint32_t value, int bytes) {
+    for (int i = 0; i < bytes; ++i) {
+        out.push_back((value >> (8 * i)) & 0xFF);
+    }
+}
+
+static void put_header(std::vector<uint8_t> &out, uint8_t type_id, uint32_t length) {
+    out.push_back(type_id);
+    out.push_back(~type_id);
+    put_le(out, length, 3);
+}
+
+// Builds a 1bpp QFF with unicode glyphs only, in the order given. Glyph pixels are all set for odd code points, and
+// all clear for even ones.
+static std::vector<uint8_t> make_font(const std::vector<std::pair<uint32_t, uint8_t>> &glyphs) {
+    std::vector<uint8_t> table;
+    std::vector<uint8_t> data;
+    for (const auto &glyph : glyphs) {
+        put_le(table, glyph.first, 3);
+        put_le(table, (data.size() << QFF_GLYPH_WIDTH_BITS) | glyph.second, 3);
+        data.insert(data.end(), (glyph.second * LINE_HEIGHT + 7) / 8, (glyph.first & 1) ? 0xFF : 0x00);
+    }
+
+    const uint32_t       total_size = 25 + 5 + table.size() + 5 + data.size();
+    std::vector<uint8_t> font;
+    put_header(font, QFF_FONT_DESCRIPTOR_TYPEID, 20);
+    put_le(font, QFF_MAGIC, 3);
+    font.push_back(0x01); // version
+    put_le(font, total_size, 4);
+    put_le(font, ~total_size, 4);
+    font.push_back(LINE_HEIGHT);
+    font.push_back(0); // no ascii table
+    put_le(font, glyphs.size(), 2);
+    font.push_back(GRAYSCALE_1BPP);
+    font.push_back(0); // flags
+    font.push_back(IMAGE_UNCOMPRESSED);
+    font.push_back(0); // transparency index
+    put_header(font, QFF_UNICODE_GLYPH_DESCRIPTOR_TYPEID, table.size());
+    font.insert(font.end(), table.begin(), table.end());
+    put_header(font, QGF_FRAME_DATA_DESCRIPTOR_TYPEID, data.size());
+    font.insert(font.end(), data.begin(), data.end());
+    return font;
+}
+
+static std::string utf8(const std::vector<uint32_t> &code_points) {
+    std::string out;
+    for (uint32_t cp : code_points) {
+        if (cp < 0x80) {
+            out += (char)cp;
+        } else if (cp < 0x800) {
+            out += (char)(0xC0 | (cp >> 6));
+            out += (char)(0x80 | (cp & 0x3F));
+        } else {
+            out += (char)(0xE0 | (cp >> 12));
+            out += (char)(0x80 | ((cp >> 6) & 0x3F));
+            out += (char)(0x80 | (cp & 0x3F));
+        }
+    }
+    return out;
+}
+
+class QpFont : public ::testing::Test {
+   protected:
+    std::vector<std::pair<uint32_t, uint8_t>> glyphs;
+
+    void SetUp() override {
+        // A CJK-sized table with gaps between code points
+        for (uint32_t i = 0; i < 400; ++i) {
+            glyphs.push_back({0x4E00 + i * 7, (uint8_t)(1 + i % 8)});
+        }
+    }
+
+    uint8_t width_of(uint32_t code_point) {
+        for (const auto &glyph : glyphs) {
+            if (glyph.first == code_point) {
+                return glyph.second;
+            }
+        }
+        return 0;
+    }
+
+    void expect_lookups(painter_font_handle_t font) {
+        ASSERT_NE(font, nullptr);
+
+        // First, last, and a selection in between
+        std::vector<uint32_t> code_points = {0x4E00, 0x4E00 + 399 * 7};
+        for (uint32_t i = 3; i < 400; i += 37) {
+            code_points.push_back(0x4E00 + i * 7);
+        }
+        int16_t expected = 0;
+        for (uint32_t cp : code_points) {
+            EXPECT_EQ(qp_textwidth(font, utf8({cp}).c_str()), width_of(cp)) << "Code point 0x" << std::hex << cp;
+            expected += width_of(cp);
+        }
+        EXPECT_EQ(qp_textwidth(font, utf8(code_points).c_str()), expected);
+
+        // Missing code points, between entries and outside of the table
+        EXPECT_EQ(qp_textwidth(font, utf8({0x4E01}).c_str()), 0);
+        EXPECT_EQ(qp_textwidth(font, utf8({0x4DFF}).c_str()), 0);
+        EXPECT_EQ(qp_textwidth(font, utf8({0x4E00 + 400 * 7}).c_str()), 0);
+        EXPECT_EQ(qp_textwidth(font, "A"), 0) << "No ascii glyphs in this font";
+    }
+};
+
+TEST_F(QpFont, SortedUnicodeLookup) {
+    const auto            data = make_font(glyphs);
+    painter_font_handle_t font = qp_load_font_mem(data.data());
+    expect_lookups(font);
+    EXPECT_TRUE(qp_close_font(font));
+}
+
+TEST_F(QpFont, UnsortedUnicodeLookup) {
+    auto reversed = glyphs;
+    std::reverse(reversed.begin(), reversed.end());
+    const auto            data = make_font(reversed);
+    painter_font_handle_t font = qp_load_font_mem(data.data());
+    expect_lookups(font);
+    EXPECT_TRUE(qp_close_font(font));
+}
+
+TEST_F(QpFont, GlyphDataIsLocated) {
+    memset(surface_drivers, 0, sizeof(surface_drivers));
+    painter_device_t surface = qp_make_rgb565_surface(PANEL_WIDTH, PANEL_HEIGHT, surface_buffer);
+    ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+
+    const auto            data = make_font(glyphs);
+    painter_font_handle_t font = qp_load_font_mem(data.data());
+    ASSERT_NE(font, nullptr);
+
+    // Alternate between glyphs drawn fully set and fully clear, from across the table
+    std::vector<uint32_t> code_points;
+    for (uint32_t i = 0; i < 400 && code_points.size() < 40; i += 11) {
+        code_points.push_back(0x4E00 + i * 7);
+    }
+    const int16_t width = qp_drawtext(surface, 0, 0, font, utf8(code_points).c_str());
+    ASSERT_GT(width, 0);
+
+    const uint16_t *pixels = (const uint16_t *)surface_buffer;
+    uint16_t        x      = 0;
+    for (uint32_t cp : code_points) {
+        const uint16_t expected = (cp & 1) ? 0xFFFF : 0x0000;
+        for (uint16_t dx = 0; dx < width_of(cp) && x + dx < PANEL_WIDTH; ++dx) {
+            for (uint16_t y = 0; y < LINE_HEIGHT; ++y) {
+                ASSERT_EQ(pixels[y * PANEL_WIDTH + x + dx], expected) << "Code point 0x" << std::hex << cp << " at " << std::dec << (x + dx) << "," << y;
+            }
+        }
+        x += width_of(cp);
+    }
+
+    EXPECT_TRUE(qp_close_font(font));
+}
@@ -0,0 +1,141 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <vector>
+#include "test_common.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_internal.h"
+#include "qp_surface_internal.h"
+
+extern const surface_painter_driver_vtable_t rgb565_surface_driver_vtable;
+}
+
+#define PANEL_WIDTH 240
+#define PANEL_HEIGHT 240
+
+static uint8_t surface_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH, PANEL_HEIGHT, 16)];
+static uint8_t target_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH, PANEL_HEIGHT, 16)];
+
+// The target is another RGB565 surface, with its viewport and pixdata calls recorded
+static std::vector<surface_dirty_rect_t> target_viewports;
+static uint32_t                          target_pixels;
+static painter_driver_vtable_t           target_vtable;
+
+static bool target_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    target_viewports.push_back({left, top, right, bottom});
+    return rgb565_surface_driver_vtable.base.viewport(device, left, top, right, bottom);
+}
+
+static bool target_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    target_pixels += native_pixel_count;
+    return rgb565_surface_driver_vtable.base.pixdata(device, pixel_data, native_pixel_count);
+}
+
+static bool overlap(const surface_dirty_rect_t &a, const surface_dirty_rect_t &b) {
+    return a.l <= b.r && b.l <= a.r && a.t <= b.b && b.t <= a.b;
+}
+
+class QpSurface : public ::testing::Test {
+   protected:
+    painter_device_t surface;
+    painter_device_t target;
+
+    void SetUp() override {
+        reset_target();
+        memset(surface_drivers, 0, sizeof(surface_drivers));
+        surface = qp_make_rgb565_surface(PANEL_WIDTH, PANEL_HEIGHT, surface_buffer);
+        target  = qp_make_rgb565_surface(PANEL_WIDTH, PANEL_HEIGHT, target_buffer);
+
+        target_vtable          = rgb565_surface_driver_vtable.base;
+        target_vtable.viewport = target_viewport;
+        target_vtable.pixdata  = target_pixdata;
+        ((painter_driver_t *)target)->driver_vtable = &target_vtable;
+
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(target, QP_ROTATION_0));
+
+        // Initialization marks the entire surface as dirty
+        ASSERT_TRUE(qp_surface_draw(surface, target, 0, 0, false));
+        EXPECT_EQ(target_viewports.size(), 1u);
+        EXPECT_EQ(target_pixels, (uint32_t)PANEL_WIDTH * PANEL_HEIGHT);
+        reset_target();
+    }
+
+    void reset_target() {
+        target_viewports.clear();
+        target_pixels = 0;
+    }
+
+    void expect_target_matches() {
+        EXPECT_EQ(memcmp(surface_buffer, target_buffer, sizeof(surface_buffer)), 0) << "Target does not match the surface";
+    }
+
+    void expect_disjoint_viewports() {
+        for (size_t i = 0; i < target_viewports.size(); ++i) {
+            for (size_t j = i + 1; j < target_viewports.size(); ++j) {
+                EXPECT_FALSE(overlap(target_viewports[i], target_viewports[j])) << "Viewports " << i << " and " << j << " overlap";
+            }
+        }
+    }
+};
+
+TEST_F(QpSurface, CleanSurfaceIsNotTransferred) {
+    EXPECT_TRUE(qp_surface_draw(surface, target, 0, 0, false));
+    EXPECT_EQ(target_viewports.size(), 0u);
+    EXPECT_EQ(target_pixels, 0u);
+}
+
+TEST_F(QpSurface, DistantDrawsAreTransferredSeparately) {
+    // Status icon in one corner, WPM counter in the other
+    EXPECT_TRUE(qp_rect(surface, 0, 0, 15, 15, 0, 255, 255, true));
+    EXPECT_TRUE(qp_rect(surface, 200, 220, 239, 239, 85, 255, 255, true));
+
+    EXPECT_TRUE(qp_surface_draw(surface, target, 0, 0, false));
+    ASSERT_EQ(target_viewports.size(), 2u);
+    EXPECT_EQ(target_pixels, 16u * 16 + 40u * 20);
+    expect_disjoint_viewports();
+    expect_target_matches();
+}
+
+TEST_F(QpSurface, OverlappingDrawsAreMerged) {
+    EXPECT_TRUE(qp_rect(surface, 10, 10, 29, 29, 0, 255, 255, true));
+    EXPECT_TRUE(qp_rect(surface, 20, 20, 39, 39, 170, 255, 255, true));
+    EXPECT_TRUE(qp_rect(surface, 30, 10, 39, 19, 85, 255, 255, true));
+
+    EXPECT_TRUE(qp_surface_draw(surface, target, 0, 0, false));
+    EXPECT_GE(target_viewports.size(), 1u);
+    EXPECT_LE(target_pixels, 30u * 30) << "More than the bounding box was transferred";
+    expect_disjoint_viewports();
+    expect_target_matches();
+}
+
+TEST_F(QpSurface, ScatteredDrawsAreBounded) {
+    for (uint16_t i = 0; i < 12; ++i) {
+        const uint16_t x = (i * 37) % (PANEL_WIDTH - 8);
+        const uint16_t y = (i * 53) % (PANEL_HEIGHT - 8);
+        EXPECT_TRUE(qp_rect(surface, x, y, x + 7, y + 7, i * 20, 255, 255, true));
+    }
+
+    EXPECT_TRUE(qp_surface_draw(surface, target, 0, 0, false));
+    EXPECT_LE(target_viewports.size(), (size_t)SURFACE_DIRTY_RECT_COUNT);
+    expect_disjoint_viewports();
+    expect_target_matches();
+}
+
+TEST_F(QpSurface, EntireSurfaceIsOneViewport) {
+    EXPECT_TRUE(qp_rect(surface, 0, 0, 15, 15, 0, 255, 255, true));
+    EXPECT_TRUE(qp_rect(surface, 200, 220, 239, 239, 85, 255, 255, true));
+
+    EXPECT_TRUE(qp_surface_draw(surface, target, 0, 0, true));
+    EXPECT_EQ(target_viewports.size(), 1u);
+    EXPECT_EQ(target_pixels, (uint32_t)PANEL_WIDTH * PANEL_HEIGHT);
+    expect_target_matches();
+
+    // Flushed, nothing left to transfer
+    reset_target();
+    EXPECT_TRUE(qp_surface_draw(surface, target, 0, 0, false));
+    EXPECT_EQ(target_viewports.size(), 0u);
+}
@@ -0,0 +1,133 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "profiling.h"
+}
+
+using testing::_;
+using testing::InSequence;
+
+class Profiling : public TestFixture {
+   public:
+    void SetUp() override {
+        profiling_reset();
+    }
+};
+
+static uint32_t histogram_total(const profile_zone_stats_t *stats) {
+    uint32_t total = 0;
+    for (uint8_t bucket = 0; bucket < PROFILING_HISTOGRAM_BUCKETS; bucket++) {
+        total += stats->histogram[bucket];
+    }
+    return total;
+}
+
+TEST_F(Profiling, TasksAreRecordedPerScan) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+
+    const profile_zone_stats_t *keyboard = profiling_get_stats(PROFILE_ZONE_KEYBOARD_TASK);
+    EXPECT_EQ(keyboard->count, 12);
+    EXPECT_EQ(profiling_get_stats(PROFILE_ZONE_MATRIX_TASK)->count, 12);
+    EXPECT_EQ(profiling_get_stats(PROFILE_ZONE_QUANTUM_TASK)->count, 12);
+    EXPECT_EQ(profiling_get_stats(PROFILE_ZONE_LED_TASK)->count, 12);
+    EXPECT_EQ(profiling_get_stats(PROFILE_ZONE_PROCESS_RECORD_QUANTUM)->count, 2);
+    EXPECT_EQ(profiling_get_stats(PROFILE_ZONE_USER_0)->count, 0);
+
+    EXPECT_LE(keyboard->min, keyboard->max);
+    EXPECT_LE(keyboard->min, keyboard->total / keyboard->count);
+    EXPECT_GE(keyboard->max, keyboard->total / keyboard->count);
+    EXPECT_EQ(histogram_total(keyboard), keyboard->count);
+}
+
+TEST_F(Profiling, DurationsAreBucketedByPowersOfFour) {
+    profiling_record(PROFILE_ZONE_USER_0, 0);
+    profiling_record(PROFILE_ZONE_USER_0, 3);
+    profiling_record(PROFILE_ZONE_USER_0, 4);
+    profiling_record(PROFILE_ZONE_USER_0, 15);
+    profiling_record(PROFILE_ZONE_USER_0, 16);
+    profiling_record(PROFILE_ZONE_USER_0, UINT32_MAX);
+
+    const profile_zone_stats_t *stats = profiling_get_stats(PROFILE_ZONE_USER_0);
+    EXPECT_EQ(stats->count, 6);
+    EXPECT_EQ(stats->min, 0);
+    EXPECT_EQ(stats->max, UINT32_MAX);
+    EXPECT_EQ(stats->histogram[0], 2);
+    EXPECT_EQ(stats->histogram[1], 2);
+    EXPECT_EQ(stats->histogram[2], 1);
+    EXPECT_EQ(stats->histogram[PROFILING_HISTOGRAM_BUCKETS - 1], 1);
+
+    profiling_reset();
+    EXPECT_EQ(stats->count, 0);
+    EXPECT_EQ(histogram_total(stats), 0);
+}
+
+TEST_F(Profiling, ZoneCallMacroRecords) {
+    int calls = 0;
+    PROFILE_ZONE_CALL(PROFILE_ZONE_USER_1, calls++);
+    PROFILE_ZONE_CALL(PROFILE_ZONE_USER_1, calls++);
+
+    EXPECT_EQ(calls, 2);
+    EXPECT_EQ(profiling_get_stats(PROFILE_ZONE_USER_1)->count, 2);
+    EXPECT_STREQ(profiling_zone_name(PROFILE_ZONE_USER_1), "user_1");
+    EXPECT_STREQ(profiling_zone_name(PROFILE_ZONE_MATRIX_TASK), "matrix_task");
+}
+
+TEST_F(Profiling, RawHidReadsStatistics) {
+    uint8_t data[32] = {0};
+
+    profiling_record(PROFILE_ZONE_USER_2, 10);
+    profiling_record(PROFILE_ZONE_USER_2, 30);
+
+    data[0] = PROFILING_RAW_HID_ID;
+    data[1] = PROFILING_RAW_HID_GET_ZONE_COUNT;
+    EXPECT_TRUE(profiling_raw_hid_receive(data, sizeof(data)));
+    EXPECT_EQ(data[2], PROFILE_ZONE_COUNT);
+
+    data[1] = PROFILING_RAW_HID_GET_ZONE_STATS;
+    data[2] = PROFILE_ZONE_USER_2;
+    EXPECT_TRUE(profiling_raw_hid_receive(data, sizeof(data)));
+    EXPECT_EQ(data[3], 2);  // count
+    EXPECT_EQ(data[7], 10); // min
+    EXPECT_EQ(data[11], 30); // max
+    EXPECT_EQ(data[15], 20); // mean
+
+    data[1] = PROFILING_RAW_HID_GET_HISTOGRAM;
+    data[2] = PROFILE_ZONE_USER_2;
+    EXPECT_TRUE(profiling_raw_hid_receive(data, sizeof(data)));
+    EXPECT_EQ(data[3], PROFILING_HISTOGRAM_BUCKETS);
+    EXPECT_EQ(data[4 + 2 * 1], 1); // 10 -> [4, 16)
+    EXPECT_EQ(data[4 + 2 * 2], 1); // 30 -> [16, 64)
+
+    data[1] = PROFILING_RAW_HID_RESET;
+    EXPECT_TRUE(profiling_raw_hid_receive(data, sizeof(data)));
+    EXPECT_EQ(profiling_get_stats(PROFILE_ZONE_USER_2)->count, 0);
+
+    data[1] = PROFILING_RAW_HID_GET_ZONE_STATS;
+    data[2] = PROFILE_ZONE_COUNT;
+    EXPECT_TRUE(profiling_raw_hid_receive(data, sizeof(data)));
+    EXPECT_EQ(data[1], 0xFF);
+
+    // too short to hold the bucket count
+    data[1] = PROFILING_RAW_HID_GET_HISTOGRAM;
+    data[2] = PROFILE_ZONE_USER_2;
+    data[3] = 0x5A;
+    EXPECT_TRUE(profiling_raw_hid_receive(data, 3));
+    EXPECT_EQ(data[1], 0xFF);
+    EXPECT_EQ(data[3], 0x5A);
+
+    data[0] = PROFILING_RAW_HID_ID + 1;
+    EXPECT_FALSE(profiling_raw_hid_receive(data, sizeof(data)));
+}
@@ -0,0 +1,11 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define RGB_MATRIX_LED_COUNT 40
+#define RGB_MATRIX_KEYPRESSES
+#define LED_HITS_TO_REMEMBER 4
+#define ENABLE_RGB_MATRIX_SOLID_REACTIVE_SIMPLE
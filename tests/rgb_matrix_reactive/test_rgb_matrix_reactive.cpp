@@ -0,0 +1,103 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+}
+
+using testing::_;
+
+class RgbMatrixReactive : public TestFixture {
+   public:
+    void SetUp() override {
+        rgb_matrix_init();
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_REACTIVE_SIMPLE);
+    }
+
+    // LEDs are numbered row by row, see test_rgb_matrix_driver.c
+    static uint8_t led_index(KeymapKey& key) {
+        return key.position.row * 10 + key.position.col;
+    }
+
+    void expect_hits(std::vector<uint8_t> leds) {
+        // let rgb_matrix_task() take a new snapshot of the hits
+        idle_for(RGB_MATRIX_LED_FLUSH_LIMIT * 2);
+        ASSERT_EQ(g_last_hit_tracker.count, leds.size());
+        for (uint8_t i = 0; i < leds.size(); i++) {
+            EXPECT_EQ(g_last_hit_tracker.index[i], leds[i]) << "hit " << +i;
+            EXPECT_EQ(g_last_hit_tracker.x[i], g_led_config.point[leds[i]].x) << "hit " << +i;
+            EXPECT_EQ(g_last_hit_tracker.y[i], g_led_config.point[leds[i]].y) << "hit " << +i;
+        }
+    }
+};
+
+TEST_F(RgbMatrixReactive, hits_are_remembered_oldest_first) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 1, 0, KC_A);
+    KeymapKey  key_b(0, 2, 1, KC_B);
+    set_keymap({key_a, key_b});
+
+    EXPECT_REPORT(driver, (KC_A)).Times(1);
+    EXPECT_REPORT(driver, (KC_B)).Times(1);
+    EXPECT_EMPTY_REPORT(driver).Times(2);
+    tap_key(key_a);
+    tap_key(key_b);
+    expect_hits({led_index(key_a), led_index(key_b)});
+    EXPECT_EQ(g_last_hit_led[led_index(key_a)], 0);
+    EXPECT_EQ(g_last_hit_led[led_index(key_b)], 1);
+    EXPECT_EQ(g_last_hit_led[0], LAST_HIT_NONE);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(RgbMatrixReactive, full_ring_drops_oldest_hits) {
+    TestDriver             driver;
+    std::vector<KeymapKey> keys;
+    for (uint8_t col = 0; col < 6; col++) {
+        keys.push_back(KeymapKey(0, col, 2, KC_A + col));
+    }
+    set_keymap({keys[0], keys[1], keys[2], keys[3], keys[4], keys[5]});
+
+    EXPECT_ANY_REPORT(driver).Times(12);
+    for (auto& key : keys) {
+        tap_key(key);
+    }
+    expect_hits({led_index(keys[2]), led_index(keys[3]), led_index(keys[4]), led_index(keys[5])});
+    EXPECT_EQ(g_last_hit_led[led_index(keys[0])], LAST_HIT_NONE);
+    EXPECT_EQ(g_last_hit_led[led_index(keys[1])], LAST_HIT_NONE);
+    EXPECT_EQ(g_last_hit_led[led_index(keys[5])], 3);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(RgbMatrixReactive, repeated_hits_point_at_latest) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 1, 3, KC_A);
+    KeymapKey  key_b(0, 2, 3, KC_B);
+    set_keymap({key_a, key_b});
+
+    EXPECT_ANY_REPORT(driver).Times(6);
+    tap_key(key_a);
+    tap_key(key_b);
+    tap_key(key_a);
+    expect_hits({led_index(key_a), led_index(key_b), led_index(key_a)});
+    EXPECT_EQ(g_last_hit_led[led_index(key_a)], 2);
+    EXPECT_LT(g_last_hit_tracker.tick[2], g_last_hit_tracker.tick[0]);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(RgbMatrixReactive, hits_expire) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 1, 0, KC_A);
+    set_keymap({key_a});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    expect_hits({led_index(key_a)});
+    idle_for(UINT16_MAX);
+    expect_hits({});
+    EXPECT_EQ(g_last_hit_led[led_index(key_a)], LAST_HIT_NONE);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,191 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "serial_loopback.h"
+#include "timer.h"
+#include "transactions.h"
+
+void advance_time(uint32_t ms);
+
+// Both halves share the test's timer, keep the sync timer out of the way
+bool is_keyboard_master(void) {
+    return true;
+}
+}
+
+#define HALF_ROWS ((MATRIX_ROWS) / 2)
+
+static matrix_row_t slave_rows[HALF_ROWS];
+
+static void slave_scan(void) {
+    matrix_row_t unused[HALF_ROWS] = {0};
+    transactions_slave(unused, slave_rows);
+}
+
+class SplitMatrixEvents : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        // Statics in transactions.c survive between tests, resync from a clean
+        // slave that has queued at least one event block
+        serial_loopback_reset();
+        memset(slave_rows, 0, sizeof(slave_rows));
+        set_key(0, 0, true);
+        set_key(0, 0, false);
+        advance_time(1000);
+        scan();
+        serial_loopback_reset_counters();
+    }
+
+    bool scan() {
+        return transactions_master(master_matrix, slave_matrix);
+    }
+
+    void set_key(uint8_t row, uint8_t col, bool pressed) {
+        if (pressed) {
+            slave_rows[row] |= (matrix_row_t)1 << col;
+        } else {
+            slave_rows[row] &= ~((matrix_row_t)1 << col);
+        }
+        serial_loopback_run_slave(slave_scan);
+    }
+
+    matrix_row_t master_matrix[HALF_ROWS] = {0};
+    matrix_row_t slave_matrix[HALF_ROWS]  = {0};
+};
+
+TEST_F(SplitMatrixEvents, changes_are_synced_as_events) {
+    serial_loopback_reset_counters();
+
+    set_key(0, 3, true);
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(slave_matrix[0], 0x0008);
+
+    set_key(1, 9, true);
+    set_key(0, 3, false);
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(slave_matrix[0], 0);
+    EXPECT_EQ(slave_matrix[1], 0x0200);
+
+    EXPECT_EQ(serial_loopback_transaction_count_id(GET_SLAVE_MATRIX_EVENTS), 2u);
+    EXPECT_EQ(serial_loopback_transaction_count_id(GET_SLAVE_MATRIX_DATA), 0u);
+}
+
+TEST_F(SplitMatrixEvents, unchanged_matrix_only_reads_the_checksum) {
+    serial_loopback_reset_counters();
+    for (int i = 0; i < 10; i++) {
+        EXPECT_TRUE(scan());
+    }
+    EXPECT_EQ(serial_loopback_transaction_count(), serial_loopback_transaction_count_id(GET_SLAVE_MATRIX_CHECKSUM));
+}
+
+TEST_F(SplitMatrixEvents, events_keep_the_slave_timestamp) {
+    uint16_t time;
+
+    set_key(0, 1, true);
+    const uint16_t press_time = timer_read();
+    advance_time(3);
+    set_key(0, 1, false);
+    const uint16_t release_time = timer_read();
+    advance_time(4);
+    set_key(1, 0, true);
+    advance_time(2);
+    EXPECT_TRUE(scan());
+
+    ASSERT_TRUE(split_matrix_event_time(0, 1, true, &time));
+    EXPECT_EQ(time, press_time);
+    ASSERT_TRUE(split_matrix_event_time(0, 1, false, &time));
+    EXPECT_EQ(time, release_time);
+    ASSERT_TRUE(split_matrix_event_time(1, 0, true, &time));
+    EXPECT_EQ(time, release_time + 4);
+    EXPECT_FALSE(split_matrix_event_time(1, 0, false, &time));
+
+    // Only the last sync is remembered
+    EXPECT_TRUE(scan());
+    EXPECT_FALSE(split_matrix_event_time(1, 0, true, &time));
+}
+
+TEST_F(SplitMatrixEvents, missed_events_recover_from_the_full_matrix) {
+    serial_loopback_reset_counters();
+
+    // Overflow the slave's event ring between two syncs
+    for (uint8_t col = 0; col < SPLIT_MATRIX_EVENTS_SIZE + 1; col++) {
+        set_key(col & 1, col, true);
+    }
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(slave_matrix[0], slave_rows[0]);
+    EXPECT_EQ(slave_matrix[1], slave_rows[1]);
+    EXPECT_EQ(serial_loopback_transaction_count_id(GET_SLAVE_MATRIX_DATA), 1u);
+
+    // Back in sequence
+    set_key(0, 0, false);
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(slave_matrix[0], slave_rows[0]);
+    EXPECT_EQ(serial_loopback_transaction_count_id(GET_SLAVE_MATRIX_DATA), 1u);
+}
+
+TEST_F(SplitMatrixEvents, damaged_events_recover_from_the_full_matrix) {
+    uint16_t time;
+    serial_loopback_reset_counters();
+
+    set_key(1, 4, true);
+    serial_loopback_slave_shmem()->smatrix.events.events[0].time ^= 0x0100;
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(slave_matrix[1], slave_rows[1]);
+    EXPECT_EQ(serial_loopback_transaction_count_id(GET_SLAVE_MATRIX_DATA), 1u);
+    EXPECT_FALSE(split_matrix_event_time(1, 4, true, &time));
+
+    // The sequence is only trusted again after an intact block
+    set_key(1, 5, true);
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(serial_loopback_transaction_count_id(GET_SLAVE_MATRIX_DATA), 2u);
+
+    set_key(1, 6, true);
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(slave_matrix[1], slave_rows[1]);
+    EXPECT_EQ(serial_loopback_transaction_count_id(GET_SLAVE_MATRIX_DATA), 2u);
+    EXPECT_TRUE(split_matrix_event_time(1, 6, true, &time));
+}
+
+TEST_F(SplitMatrixEvents, damaged_checksum_is_retried_within_the_scan) {
+    set_key(0, 7, true);
+    serial_loopback_corrupt_next_response(0, 0x10);
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(slave_matrix[0], slave_rows[0]);
+}
+
+TEST_F(SplitMatrixEvents, lossy_link_never_reports_a_state_the_slave_did_not_have) {
+    std::mt19937                     rng(0x5EED);
+    std::uniform_int_distribution<>  row(0, HALF_ROWS - 1);
+    std::uniform_int_distribution<>  col(0, MATRIX_COLS - 1);
+    std::uniform_int_distribution<>  changes(0, SPLIT_MATRIX_EVENTS_SIZE + 1);
+    std::set<std::vector<matrix_row_t>> history;
+
+    serial_loopback_reset_counters();
+    history.insert(std::vector<matrix_row_t>(slave_rows, slave_rows + HALF_ROWS));
+    serial_loopback_set_lossy(10, 10, 1234);
+
+    for (int iteration = 0; iteration < 2000; iteration++) {
+        for (int n = changes(rng); n > 0; n--) {
+            const uint8_t r = row(rng), c = col(rng);
+            set_key(r, c, !(slave_rows[r] & ((matrix_row_t)1 << c)));
+            history.insert(std::vector<matrix_row_t>(slave_rows, slave_rows + HALF_ROWS));
+        }
+        advance_time(1);
+        scan();
+        EXPECT_EQ(history.count(std::vector<matrix_row_t>(slave_matrix, slave_matrix + HALF_ROWS)), 1u) << "iteration " << iteration;
+    }
+    EXPECT_GT(serial_loopback_transaction_count_id(GET_SLAVE_MATRIX_EVENTS), serial_loopback_transaction_count_id(GET_SLAVE_MATRIX_DATA));
+
+    serial_loopback_set_lossy(0, 0, 0);
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(slave_matrix[0], slave_rows[0]);
+    EXPECT_EQ(slave_matrix[1], slave_rows[1]);
+}
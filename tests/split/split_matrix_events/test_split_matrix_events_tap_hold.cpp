@@ -0,0 +1,108 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "serial_loopback.h"
+#include "split_util.h"
+#include "transactions.h"
+}
+
+using testing::_;
+using testing::InSequence;
+
+#define HALF_ROWS ((MATRIX_ROWS) / 2)
+
+static matrix_row_t slave_half[HALF_ROWS];
+
+static void slave_half_scan(void) {
+    matrix_row_t unused[HALF_ROWS] = {0};
+    transactions_slave(unused, slave_half);
+}
+
+class SplitMatrixEventsTapHold : public TestFixture {
+   protected:
+    void SetUp() override {
+        // Statics in transactions.c survive between tests, resync from a clean
+        // slave that has queued at least one event block
+        serial_loopback_reset();
+        memset(slave_half, 0, sizeof(slave_half));
+        slave_half[0] = 1;
+        serial_loopback_run_slave(slave_half_scan);
+        slave_half[0] = 0;
+        serial_loopback_run_slave(slave_half_scan);
+        sync();
+    }
+
+    // Lets the slave half see a key change, without the master syncing yet
+    void slave_change(KeymapKey &key, bool pressed) {
+        const uint8_t row = key.position.row - slave_first_row();
+        if (pressed) {
+            slave_half[row] |= (matrix_row_t)1 << key.position.col;
+        } else {
+            slave_half[row] &= ~((matrix_row_t)1 << key.position.col);
+        }
+        serial_loopback_run_slave(slave_half_scan);
+    }
+
+    static uint8_t slave_first_row(void) {
+        return is_keyboard_left() ? HALF_ROWS : 0;
+    }
+
+    // Syncs the slave half, then scans it into the master's matrix
+    void sync() {
+        matrix_row_t master_half[HALF_ROWS] = {0};
+        matrix_row_t synced[HALF_ROWS]      = {0};
+        EXPECT_TRUE(transactions_master(master_half, synced));
+    }
+};
+
+/**
+ * A slave key seen just before a master mod-tap, but synced after it, must not
+ * be timed before the mod-tap as that would make the mod-tap time out at once.
+ */
+TEST_F(SplitMatrixEventsTapHold, slave_key_synced_after_master_mod_tap_is_a_tap) {
+    TestDriver driver;
+    InSequence s;
+
+    const uint8_t master_first_row = HALF_ROWS - slave_first_row();
+    auto          slave_key        = KeymapKey(0, 2, slave_first_row(), KC_A);
+    auto          mod_tap_key      = KeymapKey(0, 1, master_first_row, SFT_T(KC_P));
+
+    set_keymap({mod_tap_key, slave_key});
+
+    /* Slave sees its key, then the mod-tap is pressed before the next sync. */
+    EXPECT_NO_REPORT(driver);
+    slave_change(slave_key, true);
+    idle_for(1);
+    mod_tap_key.press();
+    run_one_scan_loop();
+
+    sync();
+    slave_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release the slave key, then the mod-tap. */
+    EXPECT_NO_REPORT(driver);
+    slave_change(slave_key, false);
+    sync();
+    slave_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_REPORT(driver, (KC_P, KC_A));
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
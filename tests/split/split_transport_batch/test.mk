@@ -0,0 +1,9 @@
+# Copyright 2025 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+SPLIT_KEYBOARD = yes
+
+ENCODER_ENABLE = yes
+ENCODER_DRIVER = custom
+
+SRC += serial_loopback.c
@@ -0,0 +1,209 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "action_layer.h"
+#include "action_util.h"
+#include "crc.h"
+#include "encoder.h"
+#include "serial_loopback.h"
+#include "sync_timer.h"
+#include "timer.h"
+#include "transactions.h"
+
+void advance_time(uint32_t ms);
+
+void encoder_driver_init(void) {}
+void encoder_driver_task(void) {}
+}
+
+#define HALF_ROWS ((MATRIX_ROWS) / 2)
+
+class SplitTransportBatch : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        // Statics in transactions.c survive between tests, stage the defaults and flush them
+        reset_slave();
+        layer_state = 0;
+        clear_mods();
+        scan();
+        scan();
+        reset_slave();
+    }
+
+    void reset_slave() {
+        serial_loopback_reset();
+        set_slave_matrix(0, 0);
+        update_slave_encoders();
+    }
+
+    bool scan() {
+        return transactions_master(master_matrix, slave_matrix);
+    }
+
+    void set_slave_matrix(matrix_row_t row0, matrix_row_t row1) {
+        split_slave_matrix_sync_t *smatrix = &serial_loopback_slave_shmem()->smatrix;
+        smatrix->matrix[0]                 = row0;
+        smatrix->matrix[1]                 = row1;
+        smatrix->checksum                  = crc8(smatrix->matrix, sizeof(smatrix->matrix));
+    }
+
+    void queue_slave_encoder(uint8_t index, bool clockwise) {
+        encoder_queue_event_advanced(&serial_loopback_slave_shmem()->encoders.events, index, clockwise);
+        update_slave_encoders();
+    }
+
+    void update_slave_encoders() {
+        split_slave_encoder_sync_t *encoders = &serial_loopback_slave_shmem()->encoders;
+        encoders->checksum                   = crc8(&encoders->events, sizeof(encoders->events));
+    }
+
+    // Events the master took from the slave, as "<index><+|->"
+    std::string master_encoder_events() {
+        std::string events;
+        uint8_t     index;
+        bool        clockwise;
+        while (encoder_dequeue_event(&index, &clockwise)) {
+            events += std::to_string(index) + (clockwise ? "+" : "-");
+        }
+        return events;
+    }
+
+    matrix_row_t master_matrix[HALF_ROWS] = {0};
+    matrix_row_t slave_matrix[HALF_ROWS]  = {0};
+};
+
+TEST_F(SplitTransportBatch, one_exchange_per_scan) {
+    for (int i = 0; i < 10; i++) {
+        layer_state = 1UL << (i % 4);
+        set_mods(i);
+        set_slave_matrix(i, 0);
+        EXPECT_TRUE(scan());
+    }
+    EXPECT_EQ(serial_loopback_transaction_count(), 10u);
+    EXPECT_EQ(serial_loopback_transaction_count_id(CMD_BATCH_EXCHANGE), 10u);
+}
+
+TEST_F(SplitTransportBatch, slave_matrix_arrives_in_the_same_scan) {
+    set_slave_matrix(0x0005, 0x0200);
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(slave_matrix[0], 0x0005);
+    EXPECT_EQ(slave_matrix[1], 0x0200);
+
+    set_slave_matrix(0, 0x0001);
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(slave_matrix[0], 0);
+    EXPECT_EQ(slave_matrix[1], 0x0001);
+}
+
+TEST_F(SplitTransportBatch, dirty_sections_reach_the_slave_on_the_next_exchange) {
+    layer_state = 0x04;
+    set_mods(MOD_BIT(KC_LEFT_SHIFT));
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(serial_loopback_slave_shmem()->layers.layer_state, 0u);
+
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(serial_loopback_slave_shmem()->layers.layer_state, 0x04u);
+    EXPECT_EQ(serial_loopback_slave_shmem()->mods.real_mods, MOD_BIT(KC_LEFT_SHIFT));
+    EXPECT_EQ(serial_loopback_slave_shmem()->batch.request.sections, (1UL << PUT_LAYER_STATE) | (1UL << PUT_MODS));
+}
+
+TEST_F(SplitTransportBatch, clean_sections_are_not_sent) {
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(serial_loopback_slave_shmem()->batch.request.sections, 0u);
+
+    layer_state = 0x02;
+    EXPECT_TRUE(scan());
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(serial_loopback_slave_shmem()->batch.request.sections, 1UL << PUT_LAYER_STATE);
+
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(serial_loopback_slave_shmem()->batch.request.sections, 0u);
+}
+
+TEST_F(SplitTransportBatch, corrupted_request_is_rejected_and_resent) {
+    layer_state = 0x08;
+    EXPECT_TRUE(scan());
+
+    // Byte 4 is the first payload byte, the checksum no longer matches
+    serial_loopback_corrupt_next(4, 0xFF);
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(serial_loopback_slave_shmem()->layers.layer_state, 0u);
+
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(serial_loopback_slave_shmem()->layers.layer_state, 0x08u);
+}
+
+TEST_F(SplitTransportBatch, failed_exchange_is_retried_within_the_scan) {
+    set_slave_matrix(0x0010, 0);
+    serial_loopback_drop_next(2);
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(serial_loopback_transaction_count(), 3u);
+    EXPECT_EQ(slave_matrix[0], 0x0010);
+}
+
+TEST_F(SplitTransportBatch, slave_matrix_keeps_last_known_good_state_on_failure) {
+    set_slave_matrix(0x0003, 0);
+    EXPECT_TRUE(scan());
+
+    set_slave_matrix(0x0007, 0);
+    serial_loopback_drop_next(10);
+    EXPECT_FALSE(scan());
+    EXPECT_EQ(slave_matrix[0], 0x0003);
+    serial_loopback_drop_next(0);
+
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(slave_matrix[0], 0x0007);
+}
+
+TEST_F(SplitTransportBatch, sync_timer_is_stamped_when_sent) {
+    // Past FORCED_SYNC_THROTTLE_MS, the sync timer is due again
+    advance_time(100);
+    EXPECT_TRUE(scan());
+
+    // Staged in the previous scan, but carries the time of the exchange
+    advance_time(5);
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(serial_loopback_slave_shmem()->sync_timer, sync_timer_read32() + 2);
+}
+
+TEST_F(SplitTransportBatch, encoder_events_are_applied_once_until_drained) {
+    master_encoder_events();
+
+    queue_slave_encoder(1, true);
+    queue_slave_encoder(1, false);
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(master_encoder_events(), "1+1-");
+
+    // The drain is only staged, the slave still holds both events when a new one is queued
+    queue_slave_encoder(1, true);
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(serial_loopback_slave_shmem()->encoders_drain, 2u);
+    EXPECT_EQ(master_encoder_events(), "1+");
+
+    // Still undrained on the slave, nothing new to apply
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(serial_loopback_slave_shmem()->encoders_drain, 3u);
+    EXPECT_EQ(master_encoder_events(), "");
+}
+
+TEST_F(SplitTransportBatch, encoder_drain_keeps_events_queued_after_it) {
+    encoder_events_t events = {0};
+    master_encoder_events();
+
+    // Slave side of the drain, on its own queue
+    encoder_queue_event(1, true);
+    encoder_queue_event(1, false);
+    encoder_retrieve_events(&events);
+    encoder_queue_event(1, true);
+
+    encoder_signal_queue_drain(events.enqueued);
+    encoder_task();
+
+    // Queued after the master read the queue, so it is still to be sent
+    EXPECT_EQ(master_encoder_events(), "1+");
+}
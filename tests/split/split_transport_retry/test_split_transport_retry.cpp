@@ -0,0 +1,151 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "crc.h"
+#include "serial_loopback.h"
+#include "timer.h"
+#include "transactions.h"
+#include "wpm.h"
+
+void advance_time(uint32_t ms);
+}
+
+#define HALF_ROWS ((MATRIX_ROWS) / 2)
+
+class SplitTransportRetry : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        // Statics in transactions.c survive between tests, let the link recover first
+        serial_loopback_reset();
+        set_slave_matrix(0, 0);
+        set_current_wpm(0);
+        for (int i = 0; i < 100 && split_transport_degraded(); i++) {
+            advance_time(1);
+            scan();
+        }
+        advance_time(SPLIT_TRANSACTION_BACKOFF_MAX);
+        scan();
+        ASSERT_FALSE(split_transport_degraded());
+        serial_loopback_reset_counters();
+        split_watchdog_stats_clear();
+    }
+
+    bool scan() {
+        return transactions_master(master_matrix, slave_matrix);
+    }
+
+    void set_slave_matrix(matrix_row_t row0, matrix_row_t row1) {
+        split_slave_matrix_sync_t *smatrix = &serial_loopback_slave_shmem()->smatrix;
+        smatrix->matrix[0]                 = row0;
+        smatrix->matrix[1]                 = row1;
+        smatrix->checksum                  = crc8(smatrix->matrix, sizeof(smatrix->matrix));
+    }
+
+    void degrade_link() {
+        serial_loopback_drop_next(1 + SPLIT_TRANSACTION_RETRIES);
+        EXPECT_FALSE(scan());
+        EXPECT_TRUE(split_transport_degraded());
+        serial_loopback_reset_counters();
+    }
+
+    matrix_row_t master_matrix[HALF_ROWS] = {0};
+    matrix_row_t slave_matrix[HALF_ROWS]  = {0};
+};
+
+TEST_F(SplitTransportRetry, failed_handler_is_retried_without_waiting) {
+    const uint32_t start = timer_read32();
+    serial_loopback_drop_next(UINT8_MAX);
+    EXPECT_FALSE(scan());
+    EXPECT_EQ(serial_loopback_transaction_count(), 1u + SPLIT_TRANSACTION_RETRIES);
+    EXPECT_EQ(timer_read32(), start);
+}
+
+TEST_F(SplitTransportRetry, degraded_link_tries_the_matrix_once_per_scan) {
+    degrade_link();
+    serial_loopback_drop_next(UINT8_MAX);
+    for (int i = 0; i < 10; i++) {
+        EXPECT_FALSE(scan());
+    }
+    EXPECT_EQ(serial_loopback_transaction_count(), 10u);
+    EXPECT_EQ(serial_loopback_transaction_count_id(GET_SLAVE_MATRIX_CHECKSUM), 10u);
+}
+
+TEST_F(SplitTransportRetry, low_priority_data_waits_for_the_link_to_recover) {
+    degrade_link();
+    set_current_wpm(42);
+
+    int scans = 0;
+    while (split_transport_degraded() && scans < 100) {
+        advance_time(1);
+        EXPECT_TRUE(scan());
+        scans++;
+        if (split_transport_degraded()) {
+            EXPECT_EQ(serial_loopback_transaction_count_id(PUT_WPM), 0u);
+        }
+    }
+    EXPECT_FALSE(split_transport_degraded());
+    EXPECT_EQ(serial_loopback_transaction_count_id(GET_SLAVE_MATRIX_CHECKSUM), (uint32_t)scans);
+    EXPECT_EQ(serial_loopback_transaction_count_id(PUT_WPM), 1u);
+    EXPECT_EQ(serial_loopback_slave_shmem()->current_wpm, 42);
+}
+
+TEST_F(SplitTransportRetry, low_priority_data_trickles_through_a_degraded_link) {
+    degrade_link();
+    set_current_wpm(7);
+    for (int i = 0; i < 4 * SPLIT_TRANSACTION_BACKOFF_MAX; i++) {
+        // Keep the link degraded with a failed scan every so often
+        serial_loopback_drop_next(i % 2 == 0 ? 1 : 0);
+        advance_time(1);
+        scan();
+        ASSERT_TRUE(split_transport_degraded());
+    }
+    EXPECT_GE(serial_loopback_transaction_count_id(PUT_WPM), 3u);
+    EXPECT_LE(serial_loopback_transaction_count_id(PUT_WPM), 5u);
+    EXPECT_EQ(serial_loopback_slave_shmem()->current_wpm, 7);
+}
+
+TEST_F(SplitTransportRetry, low_priority_failure_backs_off_without_failing_the_scan) {
+    serial_loopback_fail_id(PUT_WPM, true);
+    set_current_wpm(99);
+    for (int i = 0; i < 200; i++) {
+        advance_time(1);
+        EXPECT_TRUE(scan());
+    }
+    // Retried after 2, 4, 8 ... ms, capped at SPLIT_TRANSACTION_BACKOFF_MAX
+    EXPECT_LE(serial_loopback_transaction_count_id(PUT_WPM), 8u);
+    EXPECT_EQ(serial_loopback_transaction_count_id(GET_SLAVE_MATRIX_CHECKSUM), 200u);
+
+    serial_loopback_fail_id(PUT_WPM, false);
+    for (int i = 0; i < 2 * SPLIT_TRANSACTION_BACKOFF_MAX; i++) {
+        advance_time(1);
+        EXPECT_TRUE(scan());
+    }
+    EXPECT_EQ(serial_loopback_slave_shmem()->current_wpm, 99);
+}
+
+TEST_F(SplitTransportRetry, watchdog_stats_track_errors_and_latency) {
+    split_transaction_stats_t stats;
+
+    serial_loopback_fail_id(GET_SLAVE_MATRIX_CHECKSUM, true);
+    for (int i = 0; i < 3; i++) {
+        EXPECT_FALSE(scan());
+        advance_time(5);
+    }
+    ASSERT_TRUE(split_watchdog_stats(GET_SLAVE_MATRIX_CHECKSUM, &stats));
+    EXPECT_EQ(stats.errors, serial_loopback_transaction_count_id(GET_SLAVE_MATRIX_CHECKSUM));
+    EXPECT_EQ(stats.failures, stats.errors);
+
+    serial_loopback_fail_id(GET_SLAVE_MATRIX_CHECKSUM, false);
+    EXPECT_TRUE(scan());
+    ASSERT_TRUE(split_watchdog_stats(GET_SLAVE_MATRIX_CHECKSUM, &stats));
+    EXPECT_EQ(stats.failures, 0);
+    EXPECT_EQ(stats.latency, 15);
+    EXPECT_EQ(stats.latency_max, 15);
+
+    ASSERT_TRUE(split_watchdog_stats(PUT_LAYER_STATE, &stats));
+    EXPECT_EQ(stats.errors, 0);
+    EXPECT_FALSE(split_watchdog_stats(NUM_TOTAL_TRANSACTIONS, &stats));
+}
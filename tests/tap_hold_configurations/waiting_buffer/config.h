@@ -0,0 +1,12 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// Not a power of two, so the ring buffer indices wrap without masking.
+#define WAITING_BUFFER_SIZE 20
+
+// The tap-hold callbacks of these tests are pure.
+#define WAITING_BUFFER_SKIP_RETRIES
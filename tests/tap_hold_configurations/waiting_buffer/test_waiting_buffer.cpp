@@ -0,0 +1,105 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "action_tapping.h"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class WaitingBuffer : public TestFixture {
+   public:
+    std::vector<KeymapKey> regular_keys;
+
+    void SetUp() override {
+        regular_keys.clear();
+        for (uint8_t col = 2; col < MATRIX_COLS; col++) {
+            regular_keys.push_back(KeymapKey(0, col, 0, KC_A + col - 2));
+        }
+        for (auto& key : regular_keys) {
+            add_key(key);
+        }
+    }
+
+    /* Taps every regular key, 16 events in total, more than the default
+     * waiting buffer holds. */
+    void tap_regular_keys(TestDriver& driver) {
+        for (auto& key : regular_keys) {
+            EXPECT_NO_REPORT(driver);
+            key.press();
+            run_one_scan_loop();
+            key.release();
+            run_one_scan_loop();
+            VERIFY_AND_CLEAR(driver);
+        }
+    }
+};
+
+TEST_F(WaitingBuffer, tap_many_regular_keys_while_mod_tap_key_is_held) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_hold_key = KeymapKey(0, 1, 0, SFT_T(KC_P));
+
+    add_key(mod_tap_hold_key);
+
+    /* Press mod-tap-hold key. */
+    EXPECT_NO_REPORT(driver);
+    mod_tap_hold_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    tap_regular_keys(driver);
+
+    /* Release mod-tap-hold key, the whole buffer settles at once. */
+    EXPECT_REPORT(driver, (KC_P));
+    for (auto& key : regular_keys) {
+        EXPECT_REPORT(driver, (KC_P, key.code));
+        EXPECT_REPORT(driver, (KC_P));
+    }
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_hold_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(WaitingBuffer, tap_many_regular_keys_and_hold_mod_tap_key_past_tapping_term) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_hold_key = KeymapKey(0, 1, 0, SFT_T(KC_P));
+
+    add_key(mod_tap_hold_key);
+
+    /* Press mod-tap-hold key. */
+    EXPECT_NO_REPORT(driver);
+    mod_tap_hold_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    tap_regular_keys(driver);
+
+    /* Ticks within the tapping term leave the buffer alone. */
+    EXPECT_NO_REPORT(driver);
+    idle_for(TAPPING_TERM / 2);
+    VERIFY_AND_CLEAR(driver);
+
+    /* The tick that ends the tapping term settles the buffer as held. */
+    EXPECT_REPORT(driver, (KC_LSFT));
+    for (auto& key : regular_keys) {
+        EXPECT_REPORT(driver, (KC_LSFT, key.code));
+        EXPECT_REPORT(driver, (KC_LSFT));
+    }
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release mod-tap-hold key. */
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_hold_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
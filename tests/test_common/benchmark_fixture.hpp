@@ -0,0 +1,135 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "test_driver.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "debug.h"
+#include "keyboard.h"
+
+void advance_time(uint32_t ms);
+}
+
+/**
+ * @brief A scripted switch event, followed by `idle_ms` scan loops of 1ms each.
+ */
+struct BenchmarkEvent {
+    keypos_t position;
+    bool     pressed;
+    unsigned idle_ms;
+};
+
+/**
+ * @brief Replays scripted key streams through keyboard_task() and records the
+ * processing cost.
+ *
+ * Results are printed and recorded as gtest properties, `make bench:all`
+ * collects them as json in .build/bench.
+ */
+class BenchmarkFixture : public TestFixture {
+   public:
+    void SetUp() override {
+        // Console output would dominate the measurements.
+        saved_debug_config = debug_config.raw;
+        debug_config.raw   = 0;
+    }
+
+    void TearDown() override {
+        debug_config.raw = saved_debug_config;
+    }
+
+    /**
+     * @brief Maps 'a'-'z' and ' ' to KC_A-KC_Z and KC_SPACE on layer 0,
+     * filling the test matrix row by row. `overrides` replaces the keycode of
+     * individual characters, e.g. `{{'e', TD(0)}}`.
+     */
+    void add_alpha_keys(std::initializer_list<std::pair<char, uint16_t>> overrides = {}) {
+        for (uint8_t i = 0; i < 27; i++) {
+            const char c       = i < 26 ? 'a' + i : ' ';
+            uint16_t   keycode = i < 26 ? KC_A + i : KC_SPACE;
+            for (auto& entry : overrides) {
+                if (entry.first == c) {
+                    keycode = entry.second;
+                }
+            }
+            add_key(KeymapKey(0, i % MATRIX_COLS, i / MATRIX_COLS, keycode));
+        }
+    }
+
+    static keypos_t alpha_position(char c) {
+        uint8_t i = c == ' ' ? 26 : c - 'a';
+        return {.col = (uint8_t)(i % MATRIX_COLS), .row = (uint8_t)(i / MATRIX_COLS)};
+    }
+
+    /**
+     * @brief Builds a stream typing `text` with the alpha keys, holding every
+     * key for `hold_ms` and waiting `gap_ms` before the next one.
+     */
+    static std::vector<BenchmarkEvent> type_text(const char* text, unsigned hold_ms = 30, unsigned gap_ms = 30) {
+        std::vector<BenchmarkEvent> script;
+        for (const char* c = text; *c; c++) {
+            script.push_back({alpha_position(*c), true, hold_ms});
+            script.push_back({alpha_position(*c), false, gap_ms});
+        }
+        return script;
+    }
+
+    /**
+     * @brief Replays `script` `iterations` times and reports ns/event and
+     * scans/sec.
+     */
+    void run_benchmark(const std::vector<BenchmarkEvent>& script, unsigned iterations = 200) {
+        testing::NiceMock<TestDriver> driver;
+        uint64_t                      events = 0;
+        uint64_t                      scans  = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned i = 0; i < iterations; i++) {
+            for (const BenchmarkEvent& event : script) {
+                if (event.pressed) {
+                    press_key(event.position.col, event.position.row);
+                } else {
+                    release_key(event.position.col, event.position.row);
+                }
+                events++;
+                for (unsigned ms = 0; ms < event.idle_ms; ms++) {
+                    keyboard_task();
+                    advance_time(1);
+                    scans++;
+                }
+            }
+        }
+        uint64_t elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+        if (elapsed_ns == 0) {
+            elapsed_ns = 1;
+        }
+
+        const uint64_t ns_per_event  = elapsed_ns / events;
+        const uint64_t scans_per_sec = scans * 1000000000ULL / elapsed_ns;
+
+        RecordProperty("events", (int64_t)events);
+        RecordProperty("scans", (int64_t)scans);
+        RecordProperty("ns_per_event", (int64_t)ns_per_event);
+        RecordProperty("scans_per_sec", (int64_t)scans_per_sec);
+
+        const ::testing::TestInfo* const test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+        printf("%s.%s: events=%llu scans=%llu ns_per_event=%llu scans_per_sec=%llu\n", test_info->test_suite_name(), test_info->name(), (unsigned long long)events, (unsigned long long)scans, (unsigned long long)ns_per_event, (unsigned long long)scans_per_sec);
+    }
+
+   private:
+    uint8_t saved_debug_config;
+};
+
+#define BENCHMARK_TEXT "the quick brown fox jumps over the lazy dog "
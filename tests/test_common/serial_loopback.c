@@ -0,0 +1,153 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "serial_loopback.h"
+#include <string.h>
+#include "serial.h"
+#include "transactions.h"
+
+static split_shared_memory_t slave_memory;
+static uint32_t              transaction_count;
+static uint32_t              transaction_count_id[NUM_TOTAL_TRANSACTIONS];
+static uint8_t               drop_count;
+static bool                  fail_id[NUM_TOTAL_TRANSACTIONS];
+static bool                  corrupt_pending;
+static bool                  corrupt_response;
+static uint16_t              corrupt_offset;
+static uint8_t               corrupt_mask;
+static uint8_t               lossy_drop_percent;
+static uint8_t               lossy_corrupt_percent;
+static uint32_t              lossy_state;
+
+static uint32_t lossy_random(void) {
+    // xorshift32
+    lossy_state ^= lossy_state << 13;
+    lossy_state ^= lossy_state >> 17;
+    lossy_state ^= lossy_state << 5;
+    return lossy_state;
+}
+
+static void lossy_faults(split_transaction_desc_t *trans) {
+    if (lossy_random() % 100 < lossy_drop_percent) {
+        serial_loopback_drop_next(1);
+    } else if (lossy_random() % 100 < lossy_corrupt_percent) {
+        const bool     response = trans->target2initiator_buffer_size && (!trans->initiator2target_buffer_size || (lossy_random() & 1));
+        const uint16_t size     = response ? trans->target2initiator_buffer_size : trans->initiator2target_buffer_size;
+        if (size) {
+            serial_loopback_corrupt_next(lossy_random() % size, 1 << (lossy_random() % 8));
+            corrupt_response = response;
+        }
+    }
+}
+
+static void swap_shared_memory(void) {
+    split_shared_memory_t master_memory;
+    memcpy(&master_memory, split_shmem, sizeof(split_shared_memory_t));
+    memcpy(split_shmem, &slave_memory, sizeof(split_shared_memory_t));
+    memcpy(&slave_memory, &master_memory, sizeof(split_shared_memory_t));
+}
+
+void soft_serial_initiator_init(void) {}
+
+void soft_serial_target_init(void) {}
+
+bool soft_serial_transaction(int sstd_index) {
+    if (sstd_index < 0 || sstd_index >= NUM_TOTAL_TRANSACTIONS) {
+        return false;
+    }
+
+    split_transaction_desc_t *trans = &split_transaction_table[sstd_index];
+    uint8_t                  *slave = (uint8_t *)&slave_memory;
+
+    transaction_count++;
+    transaction_count_id[sstd_index]++;
+    if (lossy_drop_percent || lossy_corrupt_percent) {
+        lossy_faults(trans);
+    }
+    if (drop_count) {
+        drop_count--;
+        return false;
+    }
+    if (fail_id[sstd_index]) {
+        return false;
+    }
+
+    memcpy(slave + trans->initiator2target_offset, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size);
+    if (corrupt_pending && !corrupt_response && corrupt_offset < trans->initiator2target_buffer_size) {
+        slave[trans->initiator2target_offset + corrupt_offset] ^= corrupt_mask;
+    }
+
+    if (trans->slave_callback) {
+        swap_shared_memory();
+        trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+        swap_shared_memory();
+    }
+
+    memcpy(split_trans_target2initiator_buffer(trans), slave + trans->target2initiator_offset, trans->target2initiator_buffer_size);
+    if (corrupt_pending && corrupt_response && corrupt_offset < trans->target2initiator_buffer_size) {
+        split_trans_target2initiator_buffer(trans)[corrupt_offset] ^= corrupt_mask;
+    }
+    corrupt_pending = false;
+    return true;
+}
+
+void serial_loopback_reset(void) {
+    memset(&slave_memory, 0, sizeof(slave_memory));
+    serial_loopback_reset_counters();
+    memset(fail_id, 0, sizeof(fail_id));
+    drop_count            = 0;
+    corrupt_pending       = false;
+    lossy_drop_percent    = 0;
+    lossy_corrupt_percent = 0;
+}
+
+void serial_loopback_reset_counters(void) {
+    memset(transaction_count_id, 0, sizeof(transaction_count_id));
+    transaction_count = 0;
+}
+
+split_shared_memory_t *serial_loopback_slave_shmem(void) {
+    return &slave_memory;
+}
+
+void serial_loopback_run_slave(void (*slave_task)(void)) {
+    swap_shared_memory();
+    slave_task();
+    swap_shared_memory();
+}
+
+uint32_t serial_loopback_transaction_count(void) {
+    return transaction_count;
+}
+
+uint32_t serial_loopback_transaction_count_id(int8_t id) {
+    return id >= 0 && id < NUM_TOTAL_TRANSACTIONS ? transaction_count_id[id] : 0;
+}
+
+void serial_loopback_drop_next(uint8_t count) {
+    drop_count = count;
+}
+
+void serial_loopback_fail_id(int8_t id, bool fail) {
+    if (id >= 0 && id < NUM_TOTAL_TRANSACTIONS) {
+        fail_id[id] = fail;
+    }
+}
+
+void serial_loopback_corrupt_next(uint16_t offset, uint8_t mask) {
+    corrupt_pending  = true;
+    corrupt_response = false;
+    corrupt_offset   = offset;
+    corrupt_mask     = mask;
+}
+
+void serial_loopback_corrupt_next_response(uint16_t offset, uint8_t mask) {
+    serial_loopback_corrupt_next(offset, mask);
+    corrupt_response = true;
+}
+
+void serial_loopback_set_lossy(uint8_t drop_percent, uint8_t corrupt_percent, uint32_t seed) {
+    lossy_drop_percent    = drop_percent;
+    lossy_corrupt_percent = corrupt_percent;
+    lossy_state           = seed ? seed : 1;
+}
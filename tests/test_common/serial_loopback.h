@@ -0,0 +1,85 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "transport.h"
+
+/*
+    Host loopback for the split serial transport, add `SRC += serial_loopback.c`
+    to a test.mk with `SPLIT_KEYBOARD = yes`.
+
+    Both halves run in the test binary. split_shmem is the master's shared
+    memory, the slave's lives in the loopback and is swapped in whenever
+    slave code runs, so slave callbacks and handlers see their own copy.
+*/
+
+/**
+ * @brief Clears the slave shared memory, the counters and any pending faults.
+ */
+void serial_loopback_reset(void);
+
+/**
+ * @brief Clears the transaction counters only, the link state is kept.
+ */
+void serial_loopback_reset_counters(void);
+
+/**
+ * @brief The slave's shared memory as left by the last transaction.
+ */
+split_shared_memory_t *serial_loopback_slave_shmem(void);
+
+/**
+ * @brief Runs `slave_task` with the slave's shared memory swapped in, e.g. a
+ * wrapper around transactions_slave().
+ */
+void serial_loopback_run_slave(void (*slave_task)(void));
+
+/**
+ * @brief Number of transactions started by the master since the last reset.
+ */
+uint32_t serial_loopback_transaction_count(void);
+
+/**
+ * @brief Number of transactions of `id` started since the last reset.
+ */
+uint32_t serial_loopback_transaction_count_id(int8_t id);
+
+/**
+ * @brief Makes the next `count` transactions fail without reaching the slave.
+ */
+void serial_loopback_drop_next(uint8_t count);
+
+/**
+ * @brief Makes every transaction of `id` fail until cleared or reset.
+ */
+void serial_loopback_fail_id(int8_t id, bool fail);
+
+/**
+ * @brief Flips bits of byte `offset` of the next transaction's
+ * initiator-to-target buffer on its way to the slave.
+ */
+void serial_loopback_corrupt_next(uint16_t offset, uint8_t mask);
+
+/**
+ * @brief Flips bits of byte `offset` of the next transaction's
+ * target-to-initiator buffer on its way back to the master.
+ */
+void serial_loopback_corrupt_next_response(uint16_t offset, uint8_t mask);
+
+/**
+ * @brief Drops `drop_percent` and corrupts a random bit of another
+ * `corrupt_percent` of the following transactions, until the next reset.
+ */
+void serial_loopback_set_lossy(uint8_t drop_percent, uint8_t corrupt_percent, uint32_t seed);
+
+#ifdef __cplusplus
+}
+#endif